@@ -42,47 +42,134 @@ Client::~Client()
 	disconnect();
 }
 
-void Client::start()
+void Client::send(const tz::ClientPacket& packet)
+{
+	try
+	{
+		size_t bytesSent = m_pws->write(net::buffer(packet.SerializeAsString()));
+		std::cout << "Packet sent (" << bytesSent << " bytes)." << std::endl;
+	}
+	catch (const beast::system_error&)
+	{
+		throw std::exception("Connection closed.");
+	}
+}
+
+void Client::start(size_t batchSize, std::chrono::seconds batchAge, BatchEncoding batchEncoding)
 {
 	std::random_device rd;
 	std::default_random_engine dre(rd());
 	std::uniform_int_distribution<int> ig(Client::INTERVAL_MIN, Client::INTERVAL_MAX);
 	std::uniform_real_distribution<double> dg(Client::RANDOM_REAL_MIN, Client::RANDOM_REAL_MAX);
 
+	// The uuid is sent once, data packets leave it empty.
+	tz::ClientPacket hello;
+	hello.set_type(tz::ClientPacket::HELLO);
+	hello.mutable_hello()->set_uuid(m_uuid.data, m_uuid.size());
+	send(hello);
+
 	auto nextTime = std::chrono::system_clock::now() + std::chrono::seconds(ig(dre));
 
+	tz::ClientPacket batch;
+	size_t batchCount = 0;
+	auto batchStart = std::chrono::system_clock::now();
+
+	// Delta-of-delta state of the columnar encoding, see tz.proto.
+	int64_t lastTimestamp = 0;
+	int64_t lastDelta     = 0;
+
+	auto flushBatch = [&]()
+	{
+		if (batchCount)
+		{
+			std::cout << "Sending a batch of " << batchCount << " points..." << std::endl;
+
+			send(batch);
+			batch.Clear();
+			batchCount = 0;
+		}
+	};
+
 	do
 	{	
 		if (std::chrono::system_clock::now() >= nextTime)
 		{
-			std::cout << "Sending a packet..." << std::endl;
-
-			tz::ClientPacket::Data* pdata = new tz::ClientPacket::Data;
-			pdata->set_uuid(boost::uuids::to_string(m_uuid));
-			pdata->set_timestamp(std::chrono::system_clock::now().time_since_epoch().count());
-			pdata->set_x(dg(dre));
-			pdata->set_y(dg(dre));
+			int64_t timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+			double x = dg(dre);
+			double y = dg(dre);
 
-			tz::ClientPacket packet;
-			packet.set_type(tz::ClientPacket::DATA);
-			packet.set_allocated_data(pdata);
-
-			try
+			if (batchSize > 1)
 			{
-				size_t bytesSent = m_pws->write(net::buffer(packet.SerializeAsString()));
-				std::cout << "Packet sent (" << bytesSent << " bytes)." << std::endl;
+				if (!batchCount)
+				{
+					batchStart = std::chrono::system_clock::now();
+				}
+
+				if (batchEncoding == BatchEncoding::BE_COLUMNS)
+				{
+					batch.set_type(tz::ClientPacket::COLUMNS);
+
+					auto pcolumns = batch.mutable_columns();
+
+					if (!batchCount)
+					{
+						pcolumns->add_timestamp(timestamp);
+					}
+					else
+					{
+						int64_t delta = timestamp - lastTimestamp;
+						pcolumns->add_timestamp(batchCount == 1 ? delta : delta - lastDelta);
+						lastDelta = delta;
+					}
+
+					lastTimestamp = timestamp;
+
+					pcolumns->add_x(x);
+					pcolumns->add_y(y);
+				}
+				else
+				{
+					batch.set_type(tz::ClientPacket::BATCH);
+
+					auto pdata = batch.mutable_batch()->add_point();
+					pdata->set_timestamp(timestamp);
+					pdata->set_x(x);
+					pdata->set_y(y);
+				}
+
+				if (++batchCount >= batchSize)
+				{
+					flushBatch();
+				}
 			}
-			catch (const beast::system_error&)
+			else
 			{
-				throw std::exception("Connection closed.");
+				std::cout << "Sending a packet..." << std::endl;
+
+				tz::ClientPacket packet;
+				packet.set_type(tz::ClientPacket::DATA);
+
+				auto pdata = packet.mutable_data();
+				pdata->set_timestamp(timestamp);
+				pdata->set_x(x);
+				pdata->set_y(y);
+
+				send(packet);
 			}
 
 			nextTime = std::chrono::system_clock::now() + std::chrono::seconds(ig(dre));
 		}
 
+		if (batchCount && std::chrono::system_clock::now() - batchStart >= batchAge)
+		{
+			flushBatch();
+		}
+
 		std::this_thread::sleep_for(std::chrono::milliseconds(200));
 
 	} while (!m_needExit);
+
+	flushBatch();
 }
 
 void Client::stop()
@@ -90,12 +177,17 @@ void Client::stop()
 	m_needExit = true;
 }
 
-std::string Client::getStatistics()
+std::string Client::getStatistics(const std::vector<uint32_t>& windowSeconds)
 {
 	tz::ClientPacket packet;
 	packet.set_type(tz::ClientPacket::STATISTICS);
 	packet.set_allocated_data(nullptr);
 
+	for (auto seconds : windowSeconds)
+	{
+		packet.mutable_statistics()->add_window_seconds(seconds);
+	}
+
 	beast::flat_buffer buffer;
 	try
 	{
@@ -119,11 +211,24 @@ std::string Client::getStatistics()
 			if (i) statsStr += "\n";
 
 			auto& client = stats.client(i);
-			statsStr += client.uuid()               + " " +
+
+			boost::uuids::uuid uuid{};
+			if (client.uuid().size() == uuid.size())
+			{
+				std::copy(client.uuid().begin(), client.uuid().end(), uuid.begin());
+			}
+
+			statsStr += boost::uuids::to_string(uuid) + " " +
 				        std::to_string(client.x1()) + " " +
 				        std::to_string(client.y1()) + " " +
 				        std::to_string(client.x5()) + " " +
 				        std::to_string(client.y5());
+
+			for (const auto& window : client.window())
+			{
+				statsStr += " X_" + std::to_string(window.seconds()) + "s=" + std::to_string(window.x()) +
+				            " Y_" + std::to_string(window.seconds()) + "s=" + std::to_string(window.y());
+			}
 		}
 	}
 	else
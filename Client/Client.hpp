@@ -5,6 +5,7 @@
 #include <string>
 #include <random>
 #include <thread>
+#include <chrono>
 
 #include <boost/beast/core.hpp>
 #include <boost/beast/websocket.hpp>
@@ -27,6 +28,8 @@ namespace websocket = beast::websocket; // from <boost/beast/websocket.hpp>
 namespace net = boost::asio;            // from <boost/asio.hpp>
 using tcp = boost::asio::ip::tcp;       // from <boost/asio/ip/tcp.hpp>
 
+enum class BatchEncoding { BE_POINTS, BE_COLUMNS };
+
 class Client
 {
 	static const int INTERVAL_MIN = 5;
@@ -45,14 +48,21 @@ class Client
 	void connect();
 	void disconnect();
 
+	void send(const tz::ClientPacket& packet);
+
 public:
+	inline static constexpr auto BATCH_AGE_DEFAULT = std::chrono::seconds(60);
+
 	Client(const std::string& host, const std::string& port);
 	~Client();
 
-	void start();
+	// With batchSize > 1 points are accumulated and sent as one packet once there are batchSize of them
+	// or the oldest one has waited for batchAge. BE_POINTS sends a BATCH packet, BE_COLUMNS the more compact COLUMNS one.
+	void start(size_t batchSize = 1, std::chrono::seconds batchAge = BATCH_AGE_DEFAULT, BatchEncoding batchEncoding = BatchEncoding::BE_COLUMNS);
 	void stop();
 
-	std::string getStatistics();
+	// windowSeconds selects the windows to report besides X_1/Y_1/X_5/Y_5, all the server has if empty.
+	std::string getStatistics(const std::vector<uint32_t>& windowSeconds = {});
 };
 
 #endif // _CLIENT_H_
@@ -10,9 +10,11 @@ namespace {
 
 void printUsage()
 {
-	std::cerr << "Usage: client <host>:<port> [--statistic]\n"
+	std::cerr << "Usage: client <host>:<port> [--statistic [--windows <seconds>,...] | --batch <count> [--batch-age <seconds>] [--batch-points]]\n"
 	          << "Example:\n"
 	          << "\tclient 0.0.0.0:12345 --statistic\n"
+	          << "\tclient 0.0.0.0:12345 --statistic --windows 10,3600\n"
+	          << "\tclient 0.0.0.0:12345 --batch 10 --batch-age 120\n"
 	          << std::endl;
 }
 
@@ -23,8 +25,50 @@ int main(int argc, char* argv[])
 	std::cout << "Client" << std::endl << std::endl;
 
 	bool statistic = false;
+	std::vector<uint32_t> windowSeconds;
+	size_t batchSize = 1;
+	int batchAge = static_cast<int>(Client::BATCH_AGE_DEFAULT.count());
+	BatchEncoding batchEncoding = BatchEncoding::BE_COLUMNS;
+	bool validArgs = argc >= 2;
 
-	if (argc == 2 || argc == 3 && (statistic = !strcmp(argv[2], "--statistic")))
+	for (int i = 2; validArgs && i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "--statistic"))
+		{
+			statistic = true;
+		}
+		else if (!strcmp(argv[i], "--batch") && i + 1 < argc)
+		{
+			int count = std::atoi(argv[++i]);
+			validArgs = count > 0;
+			batchSize = count;
+		}
+		else if (!strcmp(argv[i], "--batch-age") && i + 1 < argc)
+		{
+			batchAge = std::atoi(argv[++i]);
+			validArgs = batchAge > 0;
+		}
+		else if (!strcmp(argv[i], "--batch-points"))
+		{
+			batchEncoding = BatchEncoding::BE_POINTS;
+		}
+		else if (!strcmp(argv[i], "--windows") && i + 1 < argc)
+		{
+			std::vector<std::string> windows;
+			boost::split(windows, argv[++i], [](char c){ return c == ','; });
+
+			for (const auto& window : windows)
+			{
+				int seconds = std::atoi(window.c_str());
+				validArgs = validArgs && seconds > 0;
+				windowSeconds.push_back(seconds);
+			}
+		}
+		else
+			validArgs = false;
+	}
+
+	if (validArgs)
 	{
 		try
 		{
@@ -40,12 +84,12 @@ int main(int argc, char* argv[])
 
 			if (statistic)
 			{
-				std::cout << "Statistics: " << std::endl << g_pClient->getStatistics() << std::endl;
+				std::cout << "Statistics: " << std::endl << g_pClient->getStatistics(windowSeconds) << std::endl;
 			}
 			else
 			{
 				std::signal(SIGINT, [](int signal) { if (g_pClient) g_pClient->stop(); });
-				g_pClient->start();
+				g_pClient->start(batchSize, std::chrono::seconds(batchAge), batchEncoding);
 			}
 
 			return EXIT_SUCCESS;
@@ -0,0 +1,58 @@
+#include "ClientCache.hpp"
+
+std::optional<int64_t> ClientCache::find(const Uuid& uuid) const
+{
+	auto& s = shard(uuid);
+	std::shared_lock<std::shared_mutex> lock(s.mutex);
+
+	auto it = s.clients.find(uuid);
+	if (it == s.clients.end())
+	{
+		return std::nullopt;
+	}
+
+	return it->second;
+}
+
+std::optional<Uuid> ClientCache::findUuid(int64_t clientId) const
+{
+	auto& s = idShard(clientId);
+	std::shared_lock<std::shared_mutex> lock(s.mutex);
+
+	auto it = s.uuids.find(clientId);
+	if (it == s.uuids.end())
+	{
+		return std::nullopt;
+	}
+
+	return it->second;
+}
+
+void ClientCache::insert(const Uuid& uuid, int64_t clientId)
+{
+	{
+		auto& s = idShard(clientId);
+		std::unique_lock<std::shared_mutex> lock(s.mutex);
+
+		s.uuids.insert_or_assign(clientId, uuid);
+	}
+
+	// Published by uuid last: a session can only store packets under an id the statistics can already name.
+	auto& s = shard(uuid);
+	std::unique_lock<std::shared_mutex> lock(s.mutex);
+
+	s.clients.insert_or_assign(uuid, clientId);
+}
+
+size_t ClientCache::size() const
+{
+	size_t size = 0;
+
+	for (const auto& s : m_shards)
+	{
+		std::shared_lock<std::shared_mutex> lock(s.mutex);
+		size += s.clients.size();
+	}
+
+	return size;
+}
@@ -0,0 +1,51 @@
+#ifndef _CLIENT_CACHE_H_
+#define _CLIENT_CACHE_H_
+
+#include <array>
+#include <optional>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+
+#include "Uuid.hpp"
+
+/*
+	uuid -> clients.id map shared by all sessions, plus the reverse map the statistics use to name the rows
+	they aggregate by id. Both are split into shards with their own lock, so lookups from different
+	I/O threads rarely touch the same mutex and never wait for each other.
+*/
+class ClientCache
+{
+	static const size_t SHARD_COUNT = 64;
+
+	struct Shard
+	{
+		mutable std::shared_mutex                     mutex;
+		std::unordered_map<Uuid, int64_t, UuidHash> clients;
+	};
+
+	struct IdShard
+	{
+		mutable std::shared_mutex         mutex;
+		std::unordered_map<int64_t, Uuid> uuids;
+	};
+
+	std::array<Shard, SHARD_COUNT>   m_shards;
+	std::array<IdShard, SHARD_COUNT> m_idShards;
+
+	// The last byte never reaches the low bits of UuidHash, so the shard choice doesn't skew the buckets inside a shard.
+	Shard& shard(const Uuid& uuid)             { return m_shards[uuid.data()[15] % SHARD_COUNT]; };
+	const Shard& shard(const Uuid& uuid) const { return m_shards[uuid.data()[15] % SHARD_COUNT]; };
+
+	// Ids are handed out sequentially, so consecutive clients land in different shards.
+	IdShard& idShard(int64_t clientId)             { return m_idShards[static_cast<uint64_t>(clientId) % SHARD_COUNT]; };
+	const IdShard& idShard(int64_t clientId) const { return m_idShards[static_cast<uint64_t>(clientId) % SHARD_COUNT]; };
+
+public:
+	std::optional<int64_t> find(const Uuid& uuid) const;
+	std::optional<Uuid> findUuid(int64_t clientId) const;
+	void insert(const Uuid& uuid, int64_t clientId);
+	size_t size() const;
+};
+
+#endif // _CLIENT_CACHE_H_
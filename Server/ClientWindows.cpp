@@ -0,0 +1,135 @@
+#include "ClientWindows.hpp"
+
+ClientWindows::ClientWindows(const std::vector<std::chrono::seconds>& windows, std::chrono::seconds recentRetention, size_t recentMaxPoints) :
+	m_windows(windows),
+	m_recentRetention(recentRetention),
+	m_recentMaxPoints(recentMaxPoints)
+{
+	std::sort(m_windows.begin(), m_windows.end());
+	m_windows.erase(std::unique(m_windows.begin(), m_windows.end()), m_windows.end());
+
+	if (m_windows.empty() || m_windows.front().count() <= 0)
+	{
+		throw std::exception("Invalid statistics windows.");
+	}
+
+	for (const auto& window : m_windows)
+	{
+		// The coarsest level takes whatever the finer ones can't.
+		int64_t resolution = LEVEL_RESOLUTIONS[std::size(LEVEL_RESOLUTIONS) - 1];
+
+		for (int64_t levelResolution : LEVEL_RESOLUTIONS)
+		{
+			if (window.count() / levelResolution <= MAX_WINDOW_BUCKETS)
+			{
+				resolution = levelResolution;
+				break;
+			}
+		}
+
+		// Windows are ascending, so a level is always extended by its latest window.
+		// One bucket more than the window: its first bucket is only partly inside it.
+		size_t bucketCount = static_cast<size_t>((window.count() + resolution - 1) / resolution) + 1;
+
+		if (m_levels.empty() || m_levels.back().resolution != resolution)
+		{
+			m_levels.push_back({ resolution, bucketCount });
+		}
+		else
+			m_levels.back().bucketCount = bucketCount;
+
+		m_windowLevels.push_back(m_levels.size() - 1);
+	}
+}
+
+void ClientWindows::unlink(Client* pclient)
+{
+	(pclient->pprev ? pclient->pprev->pnext : m_pnewest) = pclient->pnext;
+	(pclient->pnext ? pclient->pnext->pprev : m_poldest) = pclient->pprev;
+
+	pclient->pprev = nullptr;
+	pclient->pnext = nullptr;
+}
+
+void ClientWindows::touch(Client* pclient, int64_t second)
+{
+	pclient->lastSeen = second;
+
+	if (pclient == m_pnewest)
+	{
+		return;
+	}
+
+	if (pclient->pprev || pclient->pnext || pclient == m_poldest)
+	{
+		unlink(pclient);
+	}
+
+	pclient->pnext = m_pnewest;
+	(m_pnewest ? m_pnewest->pprev : m_poldest) = pclient;
+	m_pnewest = pclient;
+}
+
+void ClientWindows::pruneSilent(int64_t second)
+{
+	int64_t activeSince = second - longestWindow().count();
+
+	while (m_poldest && m_poldest->lastSeen < activeSince)
+	{
+		int64_t clientId = m_poldest->clientId;
+
+		unlink(m_poldest);
+		m_clients.erase(clientId);
+	}
+}
+
+void ClientWindows::add(const std::vector<StoragePoint>& points)
+{
+	int64_t now         = std::chrono::system_clock::now().time_since_epoch().count();
+	int64_t nowSecond   = WindowAggregator::toSecond(now);
+	int64_t recentSince = now - std::chrono::duration_cast<std::chrono::system_clock::duration>(m_recentRetention).count();
+	int64_t latest      = now + std::chrono::duration_cast<std::chrono::system_clock::duration>(MAX_CLOCK_SKEW).count();
+
+	std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+	// Points of a batch usually come in runs of one client.
+	Client* pclient = nullptr;
+
+	for (const auto& point : points)
+	{
+		if (point.timestamp > latest)
+		{
+			continue;
+		}
+
+		if (!pclient || point.clientId != pclient->clientId)
+		{
+			auto [it, inserted] = m_clients.try_emplace(point.clientId, point.clientId, m_recentMaxPoints);
+			pclient = &it->second;
+
+			if (inserted)
+			{
+				pclient->levels.reserve(m_levels.size());
+
+				for (const auto& level : m_levels)
+				{
+					pclient->levels.emplace_back(level.resolution, level.bucketCount);
+				}
+			}
+
+			touch(pclient, nowSecond);
+			pclient->recent.dropBefore(recentSince);
+		}
+
+		int64_t second = WindowAggregator::toSecond(point.timestamp);
+
+		for (auto& aggregator : pclient->levels)
+		{
+			aggregator.add(second, point.x, point.y);
+		}
+
+		pclient->recent.add(point.timestamp, point.x, point.y);
+	}
+
+	pruneSilent(nowSecond);
+}
@@ -0,0 +1,153 @@
+#ifndef _CLIENT_WINDOWS_H_
+#define _CLIENT_WINDOWS_H_
+
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <iterator>
+#include <exception>
+#include <unordered_map>
+#include <mutex>
+#include <shared_mutex>
+
+#include "WindowAggregator.hpp"
+#include "PointRing.hpp"
+#include "StorageWriter.hpp"
+#include "TaskPool.hpp"
+
+/*
+	The window aggregators of all clients that have sent points. The storage writer adds every batch
+	once it is committed, so the statistics answered from here match what is in the database.
+
+	Every window is served by the finest of a few resolution levels that needs no more than MAX_WINDOW_BUCKETS
+	buckets for it, e.g. 10 s and 5 min windows by one-second buckets, 1 h by minutes and 24 h by hours.
+	Each client keeps one ring per level in use, as long as the longest window of the level.
+	Windows up to recentRetention are summed exactly from the client's recent points instead, unless the
+	client has sent more than recentMaxPoints points within them; the buckets are the fallback then.
+
+	Clients are also kept in an intrusive list ordered by the time their points last arrived, most recent first.
+	Statistics walk it only as far as the clients seen within the longest window, and clients that have been
+	silent for longer are dropped from the tail as new points come in, so both scale with the active clients
+	rather than with every client that has ever connected.
+*/
+class ClientWindows
+{
+	// Clients a worker takes at a time when visiting in parallel.
+	static const size_t PARALLEL_CHUNK_SIZE = 256;
+
+	inline static const int64_t LEVEL_RESOLUTIONS[] = { 1, 60, 60 * 60 };
+	static const int64_t MAX_WINDOW_BUCKETS = 300;
+
+	// Points further ahead of the server's clock are left out. Until its time had come such a point would hold
+	// its bucket, and the points of the present that map to the same bucket would be dropped as too old.
+	inline static constexpr auto MAX_CLOCK_SKEW = std::chrono::seconds(5);
+
+	struct Level
+	{
+		int64_t resolution;
+		size_t  bucketCount;
+	};
+
+	struct Client
+	{
+		int64_t                       clientId = 0;
+		std::vector<WindowAggregator> levels;
+		PointRing                     recent;
+		int64_t                       lastSeen = 0; // Second.
+		Client*                       pprev    = nullptr;
+		Client*                       pnext    = nullptr;
+
+		Client(int64_t id, size_t recentMaxPoints) : clientId(id), recent(recentMaxPoints) { }
+	};
+
+	std::vector<std::chrono::seconds> m_windows;
+	std::vector<Level>                m_levels;
+	std::vector<size_t>               m_windowLevels;
+	std::chrono::seconds              m_recentRetention;
+	size_t                            m_recentMaxPoints;
+
+	// Map nodes never move, so the list links point into the map directly.
+	mutable std::shared_mutex           m_mutex;
+	std::unordered_map<int64_t, Client> m_clients;
+	Client*                             m_pnewest = nullptr;
+	Client*                             m_poldest = nullptr;
+
+	// Must be called with m_mutex held exclusively.
+	void unlink(Client* pclient);
+	void touch(Client* pclient, int64_t second);
+	void pruneSilent(int64_t second);
+
+public:
+	ClientWindows(const std::vector<std::chrono::seconds>& windows, std::chrono::seconds recentRetention, size_t recentMaxPoints);
+
+	// Ascending, without duplicates.
+	const std::vector<std::chrono::seconds>& windows() const { return m_windows; };
+	std::chrono::seconds longestWindow() const { return m_windows.back(); };
+
+	// Points more than MAX_CLOCK_SKEW ahead of now are left out.
+	void add(const std::vector<StoragePoint>& points);
+
+	// Calls visitor(worker, clientId, sums) for every client seen within the longest window, where sums[i] covers
+	// windows()[windowIndexes[i]] up to now (a timestamp). From minParallelClients clients on they are split across
+	// the workers of the pool, below that the caller visits them all as worker 0. Adding waits until it returns.
+	template <typename Visitor>
+	void visit(int64_t now, const std::vector<size_t>& windowIndexes, TaskPool& pool, size_t minParallelClients,
+		Visitor&& visitor) const
+	{
+		int64_t nowSecond   = WindowAggregator::toSecond(now);
+		int64_t activeSince = nowSecond - longestWindow().count();
+
+		// Window starts as timestamps for the recent points, in seconds for the buckets.
+		std::vector<int64_t> since(windowIndexes.size());
+		std::vector<int64_t> sinceSecond(windowIndexes.size());
+		std::vector<bool>    recent(windowIndexes.size());
+
+		for (size_t i = 0; i < windowIndexes.size(); ++i)
+		{
+			auto window = m_windows[windowIndexes[i]];
+
+			since[i]       = now - std::chrono::duration_cast<std::chrono::system_clock::duration>(window).count();
+			sinceSecond[i] = nowSecond - window.count();
+			recent[i]      = window <= m_recentRetention;
+		}
+
+		std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+		std::vector<const Client*> clients;
+		for (const Client* pclient = m_pnewest; pclient && pclient->lastSeen >= activeSince; pclient = pclient->pnext)
+		{
+			clients.push_back(pclient);
+		}
+
+		auto visitRange = [&](size_t worker, size_t begin, size_t end)
+		{
+			std::vector<WindowSum> sums(windowIndexes.size());
+
+			for (size_t c = begin; c < end; ++c)
+			{
+				auto pclient = clients[c];
+
+				for (size_t i = 0; i < windowIndexes.size(); ++i)
+				{
+					if (recent[i] && pclient->recent.covers(since[i]))
+					{
+						sums[i] = pclient->recent.sum(since[i]);
+					}
+					else
+						sums[i] = pclient->levels[m_windowLevels[windowIndexes[i]]].sum(sinceSecond[i]);
+				}
+
+				visitor(worker, pclient->clientId, sums);
+			}
+		};
+
+		if (clients.size() < minParallelClients || pool.workerCount() == 1)
+		{
+			visitRange(0, 0, clients.size());
+		}
+		else
+			pool.parallelFor(clients.size(), PARALLEL_CHUNK_SIZE, visitRange);
+	}
+};
+
+#endif // _CLIENT_WINDOWS_H_
@@ -0,0 +1,108 @@
+#ifndef _MPSC_QUEUE_H_
+#define _MPSC_QUEUE_H_
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+/*
+	Bounded lock-free multi-producer/single-consumer ring (D. Vyukov's bounded queue with a single consumer).
+	Every cell carries a sequence number that tells producers and the consumer whose turn it is, so neither
+	side ever waits on a lock: tryPush() fails when the ring is full and tryPop() when it is empty.
+*/
+template <typename T>
+class MpscQueue
+{
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		T                   value;
+	};
+
+	std::unique_ptr<Cell[]> m_cells;
+	size_t                  m_mask;
+
+	// Producers and the consumer work on different cache lines.
+	alignas(64) std::atomic<size_t> m_tail = 0;
+	alignas(64) size_t              m_head = 0;
+
+	static size_t roundUpToPowerOf2(size_t value)
+	{
+		size_t result = 2;
+		while (result < value) result <<= 1;
+		return result;
+	}
+
+public:
+	explicit MpscQueue(size_t capacity) :
+		m_cells(new Cell[roundUpToPowerOf2(capacity)]),
+		m_mask(roundUpToPowerOf2(capacity) - 1)
+	{
+		for (size_t i = 0; i <= m_mask; ++i)
+		{
+			m_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	MpscQueue(const MpscQueue&) = delete;
+	MpscQueue& operator=(const MpscQueue&) = delete;
+
+	size_t capacity() const { return m_mask + 1; };
+
+	// Any thread.
+	bool tryPush(const T& value)
+	{
+		size_t pos = m_tail.load(std::memory_order_relaxed);
+
+		for (;;)
+		{
+			Cell& cell = m_cells[pos & m_mask];
+			size_t sequence = cell.sequence.load(std::memory_order_acquire);
+			auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+			if (diff == 0)
+			{
+				if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					cell.value = value;
+					cell.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+				pos = m_tail.load(std::memory_order_relaxed);
+		}
+	}
+
+	// Consumer thread only.
+	bool empty() const
+	{
+		size_t sequence = m_cells[m_head & m_mask].sequence.load(std::memory_order_acquire);
+		return static_cast<intptr_t>(sequence) - static_cast<intptr_t>(m_head + 1) < 0;
+	}
+
+	// Consumer thread only.
+	bool tryPop(T& value)
+	{
+		Cell& cell = m_cells[m_head & m_mask];
+		size_t sequence = cell.sequence.load(std::memory_order_acquire);
+
+		if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(m_head + 1) < 0)
+		{
+			return false;
+		}
+
+		value = cell.value;
+		cell.sequence.store(m_head + m_mask + 1, std::memory_order_release);
+		++m_head;
+
+		return true;
+	}
+};
+
+#endif // _MPSC_QUEUE_H_
@@ -0,0 +1,95 @@
+#include "PointRing.hpp"
+#include "WindowKernels.hpp"
+
+namespace {
+	const size_t INITIAL_CAPACITY = 16;
+}
+
+void PointRing::grow()
+{
+	size_t capacity = m_timestamps.empty() ? INITIAL_CAPACITY : m_timestamps.size() * 2;
+	if (capacity > m_maxPoints) capacity = m_maxPoints;
+
+	std::vector<int64_t> timestamps(capacity);
+	std::vector<double>  x(capacity);
+	std::vector<double>  y(capacity);
+
+	// Unwrapped while copying, the oldest point goes first.
+	for (size_t i = 0; i < m_size; ++i)
+	{
+		size_t from = (m_head + i) % m_timestamps.size();
+
+		timestamps[i] = m_timestamps[from];
+		x[i]          = m_x[from];
+		y[i]          = m_y[from];
+	}
+
+	m_timestamps.swap(timestamps);
+	m_x.swap(x);
+	m_y.swap(y);
+	m_head = 0;
+}
+
+void PointRing::dropOldest()
+{
+	int64_t timestamp = m_timestamps[m_head];
+
+	if (timestamp >= m_coveredSince)
+	{
+		m_coveredSince = timestamp == std::numeric_limits<int64_t>::max() ? timestamp : timestamp + 1;
+	}
+
+	m_head = (m_head + 1) % m_timestamps.size();
+	--m_size;
+}
+
+PointRing::PointRing(size_t maxPoints) :
+	m_maxPoints(maxPoints ? maxPoints : 1)
+{ }
+
+void PointRing::add(int64_t timestamp, double x, double y)
+{
+	if (m_size == m_timestamps.size())
+	{
+		if (m_size < m_maxPoints)
+		{
+			grow();
+		}
+		else
+			dropOldest();
+	}
+
+	size_t tail = (m_head + m_size) % m_timestamps.size();
+
+	m_timestamps[tail] = timestamp;
+	m_x[tail]          = x;
+	m_y[tail]          = y;
+	++m_size;
+}
+
+void PointRing::dropBefore(int64_t timestamp)
+{
+	while (m_size && m_timestamps[m_head] < timestamp)
+	{
+		dropOldest();
+	}
+}
+
+WindowSum PointRing::sum(int64_t since) const
+{
+	// At most two contiguous runs: from the head to the end of the arrays and the wrapped part from the start.
+	size_t first = m_size < m_timestamps.size() - m_head ? m_size : m_timestamps.size() - m_head;
+
+	WindowSum sum = WindowKernels::sumSince(m_timestamps.data() + m_head, m_x.data() + m_head, m_y.data() + m_head, first, since);
+
+	if (first < m_size)
+	{
+		WindowSum wrapped = WindowKernels::sumSince(m_timestamps.data(), m_x.data(), m_y.data(), m_size - first, since);
+
+		sum.sumX    += wrapped.sumX;
+		sum.count   += wrapped.count;
+		sum.sumAbsY += wrapped.sumAbsY;
+	}
+
+	return sum;
+}
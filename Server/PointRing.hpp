@@ -0,0 +1,42 @@
+#ifndef _POINT_RING_H_
+#define _POINT_RING_H_
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+#include "WindowAggregator.hpp"
+
+/*
+	Recent points of one client, column by column: timestamps, x and y each in their own array, so window
+	sums run over contiguous memory with SIMD kernels. The ring grows by doubling up to maxPoints, then
+	drops the oldest points. Windows are exact as long as no point inside them has been dropped, which
+	covers() tells.
+*/
+class PointRing
+{
+	std::vector<int64_t> m_timestamps;
+	std::vector<double>  m_x;
+	std::vector<double>  m_y;
+	size_t               m_maxPoints;
+	size_t               m_head = 0;
+	size_t               m_size = 0;
+
+	// The latest timestamp dropped so far plus one. Windows starting earlier may miss points.
+	int64_t m_coveredSince = std::numeric_limits<int64_t>::min();
+
+	void grow();
+	void dropOldest();
+
+public:
+	explicit PointRing(size_t maxPoints);
+
+	void add(int64_t timestamp, double x, double y);
+	// Drops the oldest points while they are older than timestamp. Points that arrived late stay until they are the oldest.
+	void dropBefore(int64_t timestamp);
+
+	bool covers(int64_t since) const { return since >= m_coveredSince; };
+	WindowSum sum(int64_t since) const;
+};
+
+#endif // _POINT_RING_H_
@@ -1,67 +1,12 @@
 #include "SQLite.hpp"
 
-SQLite::SQLite(const std::string& dbName)
+void SQLite::exec(const std::string& query)
 {
-	int res = sqlite3_open_v2(dbName.c_str(), &m_psqlite3, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr);
-	if (res != SQLITE_OK)
-	{
-		throw std::exception("Can't create/open DB.");
-	}
-}
-
-SQLite::~SQLite()
-{
-	if (m_psqlite3)
-	{
-		sqlite3_close_v2(m_psqlite3);
-		m_psqlite3 = nullptr;
-	}
-}
-
-void SQLite::createTable(const std::string& tableName, const std::vector<TableColumn>& tableColumns)
-{
-	if (tableName.empty() || tableColumns.empty())
-	{
-		throw std::exception("Invalid arguments.");
-	}
-
-	std::string query = "CREATE TABLE IF NOT EXISTS " + tableName + "(";
-
-	bool first = true;
-	for (const auto& tableColumn : tableColumns)
-	{
-		std::string typeStr;
-
-		switch (tableColumn.type())
-		{
-		case ColumnType::CT_INTEGER: typeStr = "INTEGER"; break;
-		case ColumnType::CT_REAL:    typeStr = "REAL";    break;
-		case ColumnType::CT_TEXT:    typeStr = "TEXT";    break;
-		default:
-			throw std::exception("Unknown column type.");
-		}
-
-		if (first)
-		{
-			first = false;
-		}
-		else
-			query += ", ";
-
-		query += tableColumn.name() + " " + typeStr;
-
-		if (tableColumn.primaryKey()) query += " PRIMARY KEY";
-		if (tableColumn.unique())     query += " UNIQUE";
-		if (tableColumn.notNull())    query += " NOT NULL";
-	}
-
-	query += ");";
-
 	char* errMsg = nullptr;
 	int res = sqlite3_exec(m_psqlite3, query.c_str(), nullptr, nullptr, &errMsg);
 	if (res != SQLITE_OK)
 	{
-		std::string text = "Can't CREATE table \"" + tableName + "\" with error: " + errMsg;
+		std::string text = "sqlite3_exec() ERROR: " + std::string(errMsg ? errMsg : std::to_string(res));
 
 		sqlite3_free(errMsg);
 		errMsg = nullptr;
@@ -70,263 +15,144 @@ void SQLite::createTable(const std::string& tableName, const std::vector<TableCo
 	}
 }
 
-void SQLite::insertOne(const std::string& tableName, const std::vector<TableValue>& tableValues)
+sqlite3_stmt* SQLite::prepare(std::string_view query)
 {
-	if (tableName.empty() || tableValues.empty())
-	{
-		throw std::exception("Invalid arguments for insertOne().");
-	}
-
-	std::string query = "INSERT INTO " + tableName + "(";
-
-	bool first = true;
-	for (const auto& tableValue : tableValues)
-	{
-		if (first)
-		{
-			first = false;
-		}
-		else
-			query += ", ";
-
-		query += tableValue.columnName();
-	}
-
-	query += ") VALUES(";
+	auto it = m_statements.find(query.data());
 
-	for (int i = 0; i < tableValues.size(); ++i)
+	if (it != m_statements.end())
 	{
-		if (i) query += ", ";
-		query += "?";
+		++m_statementCacheHits;
+		return it->second;
 	}
 
-	query += ");";
+	++m_statementCacheMisses;
 
 	sqlite3_stmt* pstmt = nullptr;
 
-	try
+	int res = sqlite3_prepare_v3(m_psqlite3, query.data(), static_cast<int>(query.size()), SQLITE_PREPARE_PERSISTENT, &pstmt, nullptr);
+	if (res != SQLITE_OK)
 	{
-		int res = sqlite3_prepare_v2(m_psqlite3, query.c_str(), -1, &pstmt, nullptr);
-		if (res != SQLITE_OK)
-		{
-			std::string text = "sqlite3_prepare_v2() ERROR: " + std::to_string(res);
-			throw std::exception(text.c_str());
-		}
+		throwError("sqlite3_prepare_v3()", res);
+	}
 
-		int index = 1;
-		for (const auto& tableValue : tableValues)
-		{
-			auto& cellValue = tableValue.value();
+	m_statements.emplace(query.data(), pstmt);
 
-			if (std::holds_alternative<std::string>(cellValue))
-			{
-				res = sqlite3_bind_text(pstmt, index, std::get<std::string>(cellValue).c_str(), -1, nullptr);
-			}
-			else if (std::holds_alternative<int64_t>(cellValue))
-			{
-				res = sqlite3_bind_int64(pstmt, index, std::get<int64_t>(cellValue));
-			}
-			else if (std::holds_alternative<double>(cellValue))
-			{
-				res = sqlite3_bind_double(pstmt, index, std::get<double>(cellValue));
-			}
-			else
-			{
-				std::string text = "Invalid type for column: " + tableValue.columnName();
-				throw std::exception(text.c_str());
-			}
+	return pstmt;
+}
 
-			if (res != SQLITE_OK)
-			{
-				std::string text = "sqlite3_bind_*() ERROR: " + std::to_string(res);
-				throw std::exception(text.c_str());
-			}
+void SQLite::throwError(const char* function, int res)
+{
+	std::string text = std::string(function) + " ERROR: " + std::to_string(res);
+	throw std::exception(text.c_str());
+}
 
-			++index;
-		}
+void SQLite::applyConfig(const SQLiteConfig& config)
+{
+	std::string journalMode;
 
-		res = 0;
-		if ((res = sqlite3_step(pstmt)) != SQLITE_DONE)
-		{
-			std::string text = "sqlite3_step() ERROR: " + std::to_string(res);
-			throw std::exception(text.c_str());
-		}
-	}
-	catch (const std::exception& ex)
+	switch (config.journalMode)
 	{
-		if (pstmt)
-		{
-			sqlite3_finalize(pstmt);
-			pstmt = nullptr;
-		}
-
-		std::string text = "Can't INSERT into table \"" + tableName + "\": " + ex.what() + ".";
-		throw std::exception(text.c_str());
+	case JournalMode::JM_DELETE:   journalMode = "DELETE";   break;
+	case JournalMode::JM_TRUNCATE: journalMode = "TRUNCATE"; break;
+	case JournalMode::JM_PERSIST:  journalMode = "PERSIST";  break;
+	case JournalMode::JM_MEMORY:   journalMode = "MEMORY";   break;
+	case JournalMode::JM_WAL:      journalMode = "WAL";      break;
+	case JournalMode::JM_OFF:      journalMode = "OFF";      break;
+	default:
+		throw std::exception("Unknown journal mode.");
 	}
 
-	sqlite3_finalize(pstmt);
-	pstmt = nullptr;
-}
+	std::string synchronous;
 
-std::vector<TableValue> SQLite::selectOne(const std::string& tableName, const std::vector<TableColumn>& tableColumns,
-	const WhereClause* pWhereClause, const OrderByClause* pOrderByClause)
-{
-	std::vector<std::vector<TableValue>> rows;
-
-	try
+	switch (config.synchronous)
 	{
-		rows = selectMany(tableName, tableColumns, pWhereClause, pOrderByClause, 1);
+	case SynchronousMode::SM_OFF:    synchronous = "OFF";    break;
+	case SynchronousMode::SM_NORMAL: synchronous = "NORMAL"; break;
+	case SynchronousMode::SM_FULL:   synchronous = "FULL";   break;
+	case SynchronousMode::SM_EXTRA:  synchronous = "EXTRA";  break;
+	default:
+		throw std::exception("Unknown synchronous mode.");
 	}
-	catch (const std::exception& ex)
+
+	std::string tempStore;
+
+	switch (config.tempStore)
 	{
-		std::string text = "Can't SELECT from table \"" + tableName + "\": " + ex.what() + ".";
-		throw std::exception(text.c_str());
+	case TempStore::TS_DEFAULT: tempStore = "DEFAULT"; break;
+	case TempStore::TS_FILE:    tempStore = "FILE";    break;
+	case TempStore::TS_MEMORY:  tempStore = "MEMORY";  break;
+	default:
+		throw std::exception("Unknown temp store.");
 	}
 
-	std::vector<TableValue> row;
+	sqlite3_busy_timeout(m_psqlite3, config.busyTimeoutMs);
 
-	if (!rows.empty())
+	if (!config.readOnly)
 	{
-		row = std::move(rows.front());
+		// journal_mode goes first: synchronous=NORMAL is only safe once the database is in WAL mode.
+		exec("PRAGMA journal_mode = "       + journalMode                              + ";");
+		exec("PRAGMA synchronous = "        + synchronous                              + ";");
+		exec("PRAGMA wal_autocheckpoint = " + std::to_string(config.walAutocheckpoint) + ";");
 	}
 
-	return row;
+	exec("PRAGMA cache_size = "         + std::to_string(config.cacheSize)         + ";");
+	exec("PRAGMA mmap_size = "          + std::to_string(config.mmapSize)          + ";");
+	exec("PRAGMA temp_store = "         + tempStore                                + ";");
 }
 
-std::vector<std::vector<TableValue>> SQLite::selectMany(const std::string& tableName, const std::vector<TableColumn>& tableColumns,
-	const WhereClause* pWhereClause, const OrderByClause* pOrderByClause, size_t rowCount)
+SQLite::SQLite(const std::string& dbName, const SQLiteConfig& config)
 {
-	if (tableName.empty() || tableColumns.empty())
+	int flags = config.readOnly ? SQLITE_OPEN_READONLY : SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+
+	int res = sqlite3_open_v2(dbName.c_str(), &m_psqlite3, flags | SQLITE_OPEN_FULLMUTEX, nullptr);
+	if (res != SQLITE_OK)
 	{
-		throw std::exception("Invalid arguments for selectMany()");
+		throw std::exception("Can't create/open DB.");
 	}
 
-	std::string query = "SELECT ";
-
-	bool first = true;
-	for (const auto& tableColumn : tableColumns)
+	try
 	{
-		if (first)
-		{
-			first = false;
-		}
-		else
-			query += ", ";
-
-		query += tableColumn.name();
+		applyConfig(config);
 	}
-
-	query += " FROM " + tableName;
-
-	if (pWhereClause)
+	catch (const std::exception&)
 	{
-		query += " WHERE " + pWhereClause->tableValue().columnName() + " ";
-
-		switch (pWhereClause->type())
-		{
-		case ComparisonType::CT_LESSER:  query += "<"; break;
-		case ComparisonType::CT_GREATER: query += ">"; break;
-		case ComparisonType::CT_EQUAL:   query += "="; break;
-		default:
-			throw std::exception("Unknown comparison type");
-		}
+		sqlite3_close_v2(m_psqlite3);
+		m_psqlite3 = nullptr;
 
-		query += " ?";
+		throw;
 	}
+}
 
-	if (pOrderByClause)
+SQLite::~SQLite()
+{
+	for (auto& [_, pstmt] : m_statements)
 	{
-		query += " ORDER BY " + pOrderByClause->columnName() + " ";
-
-		if (pOrderByClause->order() == SortingOrder::SO_ASC)
-		{
-			query += "ASC";
-		}
-		else if (pOrderByClause->order() == SortingOrder::SO_DESC)
-		{
-			query += "DESC";
-		}
-		else
-			throw std::exception("Invalid sorting order");
+		sqlite3_finalize(pstmt);
 	}
 
-	query += ";";
+	m_statements.clear();
 
-	sqlite3_stmt* pstmt = nullptr;
-	std::vector<std::vector<TableValue>> rows;
-
-	try
+	if (m_psqlite3)
 	{
-		int res = sqlite3_prepare_v2(m_psqlite3, query.c_str(), -1, &pstmt, nullptr);
-		if (res != SQLITE_OK)
-		{
-			std::string text = "sqlite3_prepare_v2() ERROR: " + res;
-			throw std::exception(text.c_str());
-		}
-
-		if (pWhereClause)
-		{
-			auto& cellValue = pWhereClause->tableValue().value();
-
-			if (std::holds_alternative<std::string>(cellValue))
-			{
-				res = sqlite3_bind_text(pstmt, 1, std::get<std::string>(cellValue).c_str(), -1, nullptr);
-			}
-			else if (std::holds_alternative<int64_t>(cellValue))
-			{
-				res = sqlite3_bind_int64(pstmt, 1, std::get<int64_t>(cellValue));
-			}
-			else if (std::holds_alternative<double>(cellValue))
-			{
-				res = sqlite3_bind_double(pstmt, 1, std::get<double>(cellValue));
-			}
-			else
-			{
-				std::string text = "Invalid type for column: " + pWhereClause->tableValue().columnName();
-				throw std::exception(text.c_str());
-			}
-
-			if (res != SQLITE_OK)
-			{
-				std::string text = "sqlite3_bind_*() ERROR: " + std::to_string(res);
-				throw std::exception(text.c_str());
-			}
-		}
-
-		while (rowCount && sqlite3_step(pstmt) == SQLITE_ROW)
-		{
-			int i = 0;
-			std::vector<TableValue> row;
-
-			for (const auto& tableColumn : tableColumns)
-			{
-				switch (tableColumn.type())
-				{
-				case ColumnType::CT_INTEGER: row.push_back(TableValue(tableColumn.name(), sqlite3_column_int64(pstmt, i)));  break;
-				case ColumnType::CT_REAL:    row.push_back(TableValue(tableColumn.name(), sqlite3_column_double(pstmt, i))); break;
-				case ColumnType::CT_TEXT:    row.push_back(TableValue(tableColumn.name(), static_cast<std::string>((const char*)sqlite3_column_text(pstmt, i)))); break;
-				}
-
-				++i;
-			}
-
-			rows.push_back(std::move(row));
-			--rowCount;
-		}
+		sqlite3_close_v2(m_psqlite3);
+		m_psqlite3 = nullptr;
 	}
-	catch (const std::exception&)
-	{
-		if (pstmt)
-		{
-			sqlite3_finalize(pstmt);
-			pstmt = nullptr;
-		}
+}
 
-		throw;
-	}
+void SQLite::begin()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	exec("BEGIN;");
+}
 
-	sqlite3_finalize(pstmt);
-	pstmt = nullptr;
+void SQLite::commit()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	exec("COMMIT;");
+}
 
-	return rows;
+void SQLite::rollback()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	exec("ROLLBACK;");
 }
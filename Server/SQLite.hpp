@@ -2,104 +2,194 @@
 #define _SQLITE_H_
 
 #include <string>
+#include <string_view>
 #include <exception>
-#include <vector>
-#include <variant>
-#include <memory>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+#include <tuple>
+#include <utility>
+#include <cstdint>
 
 #include "..\sqlite3\sqlite3.h"
+#include "Schema.hpp"
 
-using DBVariants = std::variant<std::string, int64_t, double>;
+enum class JournalMode { JM_DELETE, JM_TRUNCATE, JM_PERSIST, JM_MEMORY, JM_WAL, JM_OFF };
 
-enum class ColumnType { CT_INTEGER, CT_REAL, CT_TEXT };
+enum class SynchronousMode { SM_OFF, SM_NORMAL, SM_FULL, SM_EXTRA };
 
-class TableColumn
-{
-	std::string m_name;
-	ColumnType  m_type;
-	bool        m_primaryKey;
-	bool        m_unique;
-	bool        m_notNull;
+enum class TempStore { TS_DEFAULT, TS_FILE, TS_MEMORY };
 
-public:
-	TableColumn(const std::string& name, const ColumnType& type, bool primaryKey = false, bool unique = false, bool notNull = true) :
-		m_name(name),
-		m_type(type),
-		m_primaryKey(primaryKey),
-		m_unique(unique),
-		m_notNull(notNull)
-	{ }
-
-	std::string name() const { return m_name;       };
-	ColumnType type()  const { return m_type;       };
-	bool primaryKey()  const { return m_primaryKey; };
-	bool unique()      const { return m_unique;     };
-	bool notNull()     const { return m_notNull;    };
+// Connection pragmas. The defaults are SQLite's own, except for the busy timeout.
+struct SQLiteConfig
+{
+	JournalMode     journalMode       = JournalMode::JM_DELETE;
+	SynchronousMode synchronous       = SynchronousMode::SM_FULL;
+	int64_t         cacheSize         = -2000; // Pages when positive, KiB when negative.
+	int64_t         mmapSize          = 0;     // Bytes.
+	TempStore       tempStore         = TempStore::TS_DEFAULT;
+	int             walAutocheckpoint = 1000;  // Pages.
+	// Other connections to the same file (e.g. the storage writer's) are waited for instead of failing with SQLITE_BUSY.
+	int             busyTimeoutMs     = 5000;
+	// Opens an existing database for reading only. journalMode and walAutocheckpoint are left to the writers then.
+	bool            readOnly          = false;
 };
 
-class TableValue
+class SQLite
 {
-	std::string m_columnName;
-	DBVariants  m_value;
+	// Returns a cached statement to its initial state when the call that used it is done.
+	class StatementReset
+	{
+		sqlite3_stmt* m_pstmt;
 
-public:
-	TableValue(const std::string& columnName, const DBVariants& value) :
-		m_columnName(columnName),
-		m_value(value)
-	{ }
+	public:
+		StatementReset(sqlite3_stmt* pstmt) : m_pstmt(pstmt) { }
+		~StatementReset()
+		{
+			sqlite3_reset(m_pstmt);
+			sqlite3_clear_bindings(m_pstmt);
+		}
 
-	std::string columnName()  const { return m_columnName; };
-	const DBVariants& value() const { return m_value;      };
-};
+		StatementReset(const StatementReset&) = delete;
+		StatementReset& operator=(const StatementReset&) = delete;
 
-enum class ComparisonType { CT_LESSER, CT_GREATER, CT_EQUAL };
+		operator sqlite3_stmt*() const { return m_pstmt; };
+	};
 
-class WhereClause
-{
-	TableValue     m_tableValue;
-	ComparisonType m_type;
+	sqlite3* m_psqlite3 = nullptr;
 
-public:
-	WhereClause(const TableValue& value, const ComparisonType& type) :
-		m_tableValue(value),
-		m_type(type)
-	{ }
+	// A cached statement can only be used by one thread at a time, so statement use is serialized per connection.
+	std::mutex                                     m_mutex;
+	// Statements of Schema.hpp, keyed by the address of their compile-time text. There are only as many of them
+	// as the program names, so they are never evicted.
+	std::unordered_map<const char*, sqlite3_stmt*> m_statements;
+	std::atomic<uint64_t>                          m_statementCacheHits   = 0;
+	std::atomic<uint64_t>                          m_statementCacheMisses = 0;
 
-	const TableValue& tableValue() const { return m_tableValue; };
-	ComparisonType type()          const { return m_type;       };
-};
+	// Must be called with m_mutex held.
+	sqlite3_stmt* prepare(std::string_view query);
+	void exec(const std::string& query);
 
-enum class SortingOrder { SO_ASC, SO_DESC };
+	void applyConfig(const SQLiteConfig& config);
 
-class OrderByClause
-{
-	std::string  m_columnName;
-	SortingOrder m_order;
+	static void throwError(const char* function, int res);
 
-public:
-	OrderByClause(const std::string& columnName, const SortingOrder& order) :
-		m_columnName(columnName),
-		m_order(order)
-	{ }
+	template <typename Columns, size_t... I>
+	static void bindColumns(sqlite3_stmt* pstmt, const typename Columns::Values& values, std::index_sequence<I...>)
+	{
+		int res = SQLITE_OK;
+		static_cast<void>((((res = Columns::template At<I>::Type::bind(pstmt, static_cast<int>(I + 1), std::get<I>(values))) == SQLITE_OK) && ...));
 
-	std::string columnName() const { return m_columnName; };
-	SortingOrder order()     const { return m_order;      };
-};
+		if (res != SQLITE_OK)
+		{
+			throwError("sqlite3_bind_*()", res);
+		}
+	}
 
-class SQLite
-{
-	sqlite3* m_psqlite3 = nullptr;
+	template <typename Columns, size_t... I>
+	static typename Columns::Values readColumns(sqlite3_stmt* pstmt, std::index_sequence<I...>)
+	{
+		return typename Columns::Values{ Columns::template At<I>::Type::read(pstmt, static_cast<int>(I))... };
+	}
+
+	// Binds the parameters, steps through all rows and leaves the statement ready for the next parameters.
+	template <typename Statement, typename Visitor>
+	static size_t run(sqlite3_stmt* pstmt, const typename Statement::Parameters::Values& parameters, Visitor& visitor)
+	{
+		using Results = typename Statement::Results;
+
+		bindColumns<typename Statement::Parameters>(pstmt, parameters, std::make_index_sequence<Statement::Parameters::COUNT>());
+
+		size_t count = 0;
+		int res = 0;
+
+		while ((res = sqlite3_step(pstmt)) == SQLITE_ROW)
+		{
+			visitor(readColumns<Results>(pstmt, std::make_index_sequence<Results::COUNT>()));
+			++count;
+		}
+
+		sqlite3_reset(pstmt);
+
+		if (res != SQLITE_DONE)
+		{
+			throwError("sqlite3_step()", res);
+		}
+
+		return count;
+	}
 
 public:
-	SQLite(const std::string& dbName);
+	SQLite(const std::string& dbName, const SQLiteConfig& config = SQLiteConfig());
 	~SQLite();
 
-	void createTable(const std::string& tableName, const std::vector<TableColumn>& tableColumns);
-	void insertOne(const std::string& tableName, const std::vector<TableValue>& tableValues);
-	std::vector<TableValue> selectOne(const std::string& tableName, const std::vector<TableColumn>& tableColumns,
-		const WhereClause* pWhereClause = nullptr, const OrderByClause* pOrderByClause = nullptr);
-	std::vector<std::vector<TableValue>> selectMany(const std::string& tableName, const std::vector<TableColumn>& tableColumns,
-		const WhereClause* pWhereClause = nullptr, const OrderByClause* pOrderByClause = nullptr, size_t rowCount = -1);
+	/*
+		Statements described in Schema.hpp. Their text exists at compile time and they are prepared once per
+		connection; parameters are bound and results read through the column types.
+	*/
+
+	// Calls visitor(const Statement::Results::Values&) for every row the statement returns and returns the number of rows.
+	template <typename Statement, typename Visitor, typename... Arguments>
+	size_t query(Visitor&& visitor, const Arguments&... arguments)
+	{
+		static_assert(sizeof...(Arguments) == Statement::Parameters::COUNT, "Every parameter of the statement needs a value.");
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		StatementReset pstmt(prepare(SqlOf<Statement>::TEXT));
+		return run<Statement>(pstmt, typename Statement::Parameters::Values(arguments...), visitor);
+	}
+
+	template <typename Statement, typename... Arguments>
+	void execute(const Arguments&... arguments)
+	{
+		query<Statement>([](const typename Statement::Results::Values&) { }, arguments...);
+	}
+
+	// Runs the statement once per item in one BEGIN IMMEDIATE ... COMMIT transaction. valuesOf(item) returns
+	// the Statement::Parameters::Values of an item.
+	template <typename Statement, typename Items, typename ValuesOf>
+	void executeMany(const Items& items, ValuesOf&& valuesOf)
+	{
+		auto ignore = [](const typename Statement::Results::Values&) { };
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		try
+		{
+			exec("BEGIN IMMEDIATE;");
+
+			try
+			{
+				StatementReset pstmt(prepare(SqlOf<Statement>::TEXT));
+
+				for (const auto& item : items)
+				{
+					run<Statement>(pstmt, valuesOf(item), ignore);
+				}
+
+				exec("COMMIT;");
+			}
+			catch (const std::exception&)
+			{
+				sqlite3_exec(m_psqlite3, "ROLLBACK;", nullptr, nullptr, nullptr);
+				throw;
+			}
+		}
+		catch (const std::exception& ex)
+		{
+			std::string text = "Can't execute \"" + std::string(SqlOf<Statement>::TEXT) + "\": " + ex.what() + ".";
+			throw std::exception(text.c_str());
+		}
+	}
+
+	// Explicit transactions. A read transaction keeps one snapshot of the database for all selects inside it.
+	void begin();
+	void commit();
+	void rollback();
+
+	uint64_t statementCacheHits()   const { return m_statementCacheHits;   };
+	uint64_t statementCacheMisses() const { return m_statementCacheMisses; };
 };
 
 #endif // _SQLITE_H_
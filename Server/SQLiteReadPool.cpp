@@ -0,0 +1,67 @@
+#include "SQLiteReadPool.hpp"
+
+SQLiteReadPool::Lease::Lease(SQLiteReadPool* ppool, std::unique_ptr<SQLite> psqlite3) :
+	m_ppool(ppool),
+	m_psqlite3(std::move(psqlite3))
+{
+	m_psqlite3->begin();
+}
+
+SQLiteReadPool::Lease::~Lease()
+{
+	if (!m_psqlite3)
+	{
+		return;
+	}
+
+	try
+	{
+		m_psqlite3->commit();
+	}
+	catch (const std::exception&)
+	{
+		// A connection that can't end its transaction is not reused.
+		return;
+	}
+
+	m_ppool->release(std::move(m_psqlite3));
+}
+
+void SQLiteReadPool::release(std::unique_ptr<SQLite> psqlite3)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	if (m_idle.size() < m_maxIdle)
+	{
+		m_idle.push_back(std::move(psqlite3));
+	}
+}
+
+SQLiteReadPool::SQLiteReadPool(const std::string& dbName, const SQLiteConfig& config, size_t maxIdle) :
+	m_dbName(dbName),
+	m_config(config),
+	m_maxIdle(maxIdle)
+{
+	m_config.readOnly = true;
+}
+
+SQLiteReadPool::Lease SQLiteReadPool::acquire()
+{
+	std::unique_ptr<SQLite> psqlite3;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (!m_idle.empty())
+		{
+			psqlite3 = std::move(m_idle.back());
+			m_idle.pop_back();
+		}
+	}
+
+	if (!psqlite3)
+	{
+		psqlite3 = std::make_unique<SQLite>(m_dbName, m_config);
+	}
+
+	return Lease(this, std::move(psqlite3));
+}
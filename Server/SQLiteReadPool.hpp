@@ -0,0 +1,51 @@
+#ifndef _SQLITE_READ_POOL_H_
+#define _SQLITE_READ_POOL_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+#include "SQLite.hpp"
+
+/*
+	Read-only connections for queries that must not compete with the writers. In WAL mode every connection
+	reads its own snapshot, so readers run in parallel with each other and with the storage writer.
+	A lease holds one connection inside a read transaction: all selects through it see the same snapshot.
+	Connections are opened on demand, at most maxIdle of them are kept for reuse.
+*/
+class SQLiteReadPool
+{
+	std::string  m_dbName;
+	SQLiteConfig m_config;
+	size_t       m_maxIdle;
+
+	std::mutex                           m_mutex;
+	std::vector<std::unique_ptr<SQLite>> m_idle;
+
+	void release(std::unique_ptr<SQLite> psqlite3);
+
+public:
+	class Lease
+	{
+		SQLiteReadPool*         m_ppool;
+		std::unique_ptr<SQLite> m_psqlite3;
+
+	public:
+		Lease(SQLiteReadPool* ppool, std::unique_ptr<SQLite> psqlite3);
+		~Lease();
+
+		Lease(Lease&& other) = default;
+		Lease(const Lease&) = delete;
+		Lease& operator=(const Lease&) = delete;
+
+		SQLite* operator->() const { return m_psqlite3.get(); };
+		SQLite& operator*()  const { return *m_psqlite3;      };
+	};
+
+	SQLiteReadPool(const std::string& dbName, const SQLiteConfig& config, size_t maxIdle);
+
+	Lease acquire();
+};
+
+#endif // _SQLITE_READ_POOL_H_
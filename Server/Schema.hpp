@@ -0,0 +1,250 @@
+#ifndef _SCHEMA_H_
+#define _SCHEMA_H_
+
+#include <string_view>
+#include <array>
+#include <tuple>
+#include <cstddef>
+#include <cstdint>
+
+#include "..\sqlite3\sqlite3.h"
+
+/*
+	Tables and statements described with types. A column is a struct with a constexpr NAME, a column type
+	and constraints; a statement is a struct that writes its SQL text.
+	The text is generated during compilation (see SqlOf), and the column types bind and read values with the
+	one sqlite3_bind_* / sqlite3_column_* call that fits, so running a statement builds no strings and
+	dispatches on no variants. SQLite::execute/query/executeMany run them.
+*/
+
+// Column types. Text and blob values point into the caller's or SQLite's buffer: bind them only for the
+// statement step they are bound for, read them only until the next step.
+struct SqlInteger
+{
+	using Value = int64_t;
+	static constexpr std::string_view NAME = "INTEGER";
+
+	static int bind(sqlite3_stmt* pstmt, int index, Value value) { return sqlite3_bind_int64(pstmt, index, value); };
+	static Value read(sqlite3_stmt* pstmt, int column)           { return sqlite3_column_int64(pstmt, column);     };
+};
+
+struct SqlReal
+{
+	using Value = double;
+	static constexpr std::string_view NAME = "REAL";
+
+	static int bind(sqlite3_stmt* pstmt, int index, Value value) { return sqlite3_bind_double(pstmt, index, value); };
+	static Value read(sqlite3_stmt* pstmt, int column)           { return sqlite3_column_double(pstmt, column);     };
+};
+
+struct SqlText
+{
+	using Value = std::string_view;
+	static constexpr std::string_view NAME = "TEXT";
+
+	static int bind(sqlite3_stmt* pstmt, int index, Value value)
+	{
+		return sqlite3_bind_text(pstmt, index, value.data(), static_cast<int>(value.size()), SQLITE_STATIC);
+	};
+	static Value read(sqlite3_stmt* pstmt, int column)
+	{
+		auto ptext = reinterpret_cast<const char*>(sqlite3_column_text(pstmt, column));
+		return Value(ptext ? ptext : "", sqlite3_column_bytes(pstmt, column));
+	};
+};
+
+struct SqlBlob
+{
+	using Value = std::string_view;
+	static constexpr std::string_view NAME = "BLOB";
+
+	static int bind(sqlite3_stmt* pstmt, int index, Value value)
+	{
+		return sqlite3_bind_blob(pstmt, index, value.data(), static_cast<int>(value.size()), SQLITE_STATIC);
+	};
+	static Value read(sqlite3_stmt* pstmt, int column)
+	{
+		auto pblob = static_cast<const char*>(sqlite3_column_blob(pstmt, column));
+		return Value(pblob, pblob ? sqlite3_column_bytes(pstmt, column) : 0);
+	};
+};
+
+// Base of column structs, which add their NAME and may replace CONSTRAINTS:
+//     struct Id : Column<SqlInteger> { static constexpr std::string_view NAME = "id"; };
+template <typename SqlType>
+struct Column
+{
+	using Type = SqlType;
+	static constexpr std::string_view CONSTRAINTS = " NOT NULL";
+};
+
+// Counts and then writes the characters of a statement in constant expressions.
+struct SqlLength
+{
+	size_t size = 0;
+
+	constexpr SqlLength& operator<<(std::string_view part) { size += part.size(); return *this; };
+};
+
+template <size_t N>
+struct SqlChars
+{
+	std::array<char, N + 1> chars{};
+	size_t                  size = 0;
+
+	constexpr SqlChars& operator<<(std::string_view part)
+	{
+		for (char c : part) chars[size++] = c;
+		return *this;
+	};
+};
+
+// The SQL text of Statement, generated once at compile time. Its address identifies the statement too.
+template <typename Statement>
+struct SqlOf
+{
+	static constexpr size_t LENGTH = [] { SqlLength length; Statement::write(length); return length.size; }();
+	static constexpr SqlChars<LENGTH> CHARS = [] { SqlChars<LENGTH> chars; Statement::write(chars); return chars; }();
+	static constexpr std::string_view TEXT{ CHARS.chars.data(), LENGTH };
+};
+
+template <typename... Columns>
+struct ColumnList
+{
+	static constexpr size_t COUNT = sizeof...(Columns);
+
+	using Values = std::tuple<typename Columns::Type::Value...>;
+
+	template <size_t I>
+	using At = std::tuple_element_t<I, std::tuple<Columns...>>;
+
+	// "a, b, c"
+	template <typename Out>
+	static constexpr void names(Out& out)
+	{
+		[[maybe_unused]] size_t i = 0;
+		((out << (i++ ? ", " : "") << Columns::NAME), ...);
+	}
+
+	// "?, ?, ?"
+	template <typename Out>
+	static constexpr void placeholders(Out& out)
+	{
+		[[maybe_unused]] size_t i = 0;
+		((out << (i++ ? ", ?" : "?"), static_cast<void>(sizeof(Columns))), ...);
+	}
+
+	// "a INTEGER PRIMARY KEY NOT NULL, b REAL NOT NULL"
+	template <typename Out>
+	static constexpr void definitions(Out& out)
+	{
+		[[maybe_unused]] size_t i = 0;
+		((out << (i++ ? ", " : "") << Columns::NAME << " " << Columns::Type::NAME << Columns::CONSTRAINTS), ...);
+	}
+};
+
+// Comparisons for Where.
+struct Equal          { static constexpr std::string_view SQL = " = ?";  };
+struct Lesser         { static constexpr std::string_view SQL = " < ?";  };
+struct Greater        { static constexpr std::string_view SQL = " > ?";  };
+struct GreaterOrEqual { static constexpr std::string_view SQL = " >= ?"; };
+
+struct NoCondition
+{
+	using Parameters = ColumnList<>;
+
+	template <typename Out>
+	static constexpr void write(Out&) { }
+};
+
+template <typename Column, typename Comparison>
+struct Where
+{
+	using Parameters = ColumnList<Column>;
+
+	template <typename Out>
+	static constexpr void write(Out& out) { out << " WHERE " << Column::NAME << Comparison::SQL; }
+};
+
+// Statements. Parameters are the columns of their placeholders in order, Results the columns of their rows.
+
+template <typename Table>
+struct CreateTable
+{
+	using Parameters = ColumnList<>;
+	using Results    = ColumnList<>;
+
+	template <typename Out>
+	static constexpr void write(Out& out)
+	{
+		out << "CREATE TABLE IF NOT EXISTS " << Table::NAME << "(";
+		Table::Columns::definitions(out);
+		out << ");";
+	}
+};
+
+// Index is a struct with a constexpr NAME and the indexed Columns as a ColumnList.
+template <typename Table, typename Index>
+struct CreateIndex
+{
+	using Parameters = ColumnList<>;
+	using Results    = ColumnList<>;
+
+	template <typename Out>
+	static constexpr void write(Out& out)
+	{
+		out << "CREATE INDEX IF NOT EXISTS " << Index::NAME << " ON " << Table::NAME << "(";
+		Index::Columns::names(out);
+		out << ");";
+	}
+};
+
+// With IgnoreConflicts rows that violate a constraint are skipped, and Returning then yields no row for them.
+template <typename Table, typename Inserted, bool IgnoreConflicts = false, typename Returning = ColumnList<>>
+struct InsertInto
+{
+	using Parameters = Inserted;
+	using Results    = Returning;
+
+	template <typename Out>
+	static constexpr void write(Out& out)
+	{
+		out << "INSERT INTO " << Table::NAME << "(";
+		Inserted::names(out);
+		out << ") VALUES(";
+		Inserted::placeholders(out);
+		out << ")";
+
+		if (IgnoreConflicts)
+		{
+			out << " ON CONFLICT DO NOTHING";
+		}
+
+		if (Returning::COUNT)
+		{
+			out << " RETURNING ";
+			Returning::names(out);
+		}
+
+		out << ";";
+	}
+};
+
+template <typename Table, typename Selected, typename Condition = NoCondition>
+struct SelectFrom
+{
+	using Parameters = typename Condition::Parameters;
+	using Results    = Selected;
+
+	template <typename Out>
+	static constexpr void write(Out& out)
+	{
+		out << "SELECT ";
+		Selected::names(out);
+		out << " FROM " << Table::NAME;
+		Condition::write(out);
+		out << ";";
+	}
+};
+
+#endif // _SCHEMA_H_
@@ -1,218 +1,483 @@
 #include "Server.hpp"
 
-void Server::clientThread(tcp::socket socket)
+SQLiteConfig Server::sqliteConfig(Durability durability)
 {
+	SQLiteConfig config;
+	config.journalMode = JournalMode::JM_WAL;
+
+	switch (durability)
+	{
+	case Durability::D_SAFE:
+		config.synchronous = SynchronousMode::SM_FULL;
+		break;
+
+	case Durability::D_BALANCED:
+		config.synchronous = SynchronousMode::SM_NORMAL;
+		config.cacheSize   = -64 * 1024;
+		config.mmapSize    = 256 * 1024 * 1024;
+		config.tempStore   = TempStore::TS_MEMORY;
+		break;
+
+	case Durability::D_FAST:
+		config.synchronous       = SynchronousMode::SM_OFF;
+		config.cacheSize         = -64 * 1024;
+		config.mmapSize          = 256 * 1024 * 1024;
+		config.tempStore         = TempStore::TS_MEMORY;
+		config.walAutocheckpoint = 10000;
+		break;
+
+	default:
+		throw std::exception("Unknown durability profile.");
+	}
+
+	return config;
+}
+
+void Server::doAccept()
+{
+	m_acceptor.async_accept(net::make_strand(m_ioc), beast::bind_front_handler(&Server::onAccept, this));
+}
+
+void Server::onAccept(beast::error_code ec, tcp::socket socket)
+{
+	// Runs on the acceptor's strand, like stop(): once the acceptor is closed a connection accepted just before
+	// must not become a session stop() has never seen.
+	if (!m_acceptor.is_open())
+	{
+		beast::error_code ignored;
+		socket.close(ignored);
+		return;
+	}
+
+	if (ec)
+	{
+		std::cerr << "Can't accept connection: " << ec.message() << std::endl;
+
+		// Out of descriptors or memory: give sessions a moment to go away instead of spinning on the error.
+		// Errors of a single connection (e.g. it was aborted while queued) don't stop the next accept.
+		if (ec == beast::errc::too_many_files_open || ec == beast::errc::too_many_files_open_in_system ||
+			ec == beast::errc::no_buffer_space || ec == beast::errc::not_enough_memory)
+		{
+			m_acceptRetryTimer.expires_after(ACCEPT_RETRY_DELAY);
+			m_acceptRetryTimer.async_wait([this](beast::error_code ec)
+			{
+				if (!ec && m_acceptor.is_open())
+				{
+					doAccept();
+				}
+			});
+
+			return;
+		}
+
+		doAccept();
+		return;
+	}
+
+	// Nothing thrown here may leave the handler: it would end the I/O thread and, through run(), the server.
 	try
 	{
-		websocket::stream<tcp::socket> ws{ std::move(socket) };
-		ws.binary(true);
-		ws.accept();
+		beast::error_code ec;
+		auto endpoint = socket.remote_endpoint(ec);
 
-		while (!m_needExit)
+		if (ec)
+		{
+			// The peer has already reset the connection, there is nothing to serve.
+			socket.close(ec);
+		}
+		else if (m_config.maxConnections && connectionCount() >= m_config.maxConnections)
 		{
-			beast::flat_buffer buffer;
-			ws.read(buffer);
+			std::cerr << "Too many connections (" << m_config.maxConnections << "), rejecting " << endpoint.address() << std::endl;
 
-			tz::ClientPacket packet;
-			packet.ParseFromString(beast::buffers_to_string(buffer.data()));
+			socket.close(ec);
+		}
+		else
+		{
+			std::cout << "Client connected from " << endpoint.address() << ":" << endpoint.port() << std::endl;
 
-			switch (packet.type())
+			// A refused session is never started, so dropping it here closes its socket.
+			auto session = std::make_shared<Session>(*this, std::move(socket));
+			if (registerSession(session))
 			{
-			case tz::ClientPacket::DATA:
-				std::cout << "Packet received: "
-					      << packet.data().uuid()                      << " "
-					      << std::to_string(packet.data().timestamp()) << " "
-					      << std::to_string(packet.data().x())         << " "
-					      << std::to_string(packet.data().y())         << std::endl;
-				saveClientPacket(packet);
-				break;
-
-			case tz::ClientPacket::STATISTICS:
-				ws.write(net::buffer(collectStatistics()->SerializeAsString()));
-				std::cout << "Statistics sent." << std::endl;
-				break;
-
-			default:
-				std::cout << "Unknown packet type. Ignoring..." << std::endl;
+				session->start();
 			}
 		}
 	}
-	catch (const beast::system_error&)
+	catch (const std::exception& ex)
 	{
-		std::cerr << "Connection closed." << std::endl;
+		std::cerr << "Can't accept connection: " << ex.what() << std::endl;
 	}
-	catch (const std::bad_variant_access&)
+
+	doAccept();
+}
+
+bool Server::registerSession(const std::shared_ptr<Session>& session)
+{
+	std::lock_guard<std::mutex> lock(m_sessionsMutex);
+
+	if (m_stopping)
 	{
-		std::cerr << "Invalid type from the DB." << std::endl;
+		return false;
 	}
-	catch (const std::exception& ex)
+
+	m_sessions.emplace(session.get(), session);
+	return true;
+}
+
+void Server::unregisterSession(Session* session)
+{
+	std::lock_guard<std::mutex> lock(m_sessionsMutex);
+	m_sessions.erase(session);
+}
+
+int64_t Server::registerClient(const Uuid& uuid)
+{
+	if (auto clientId = m_clientCache.find(uuid))
+	{
+		return *clientId;
+	}
+
+	std::string_view uuidBlob(reinterpret_cast<const char*>(uuid.data()), uuid.size());
+	std::optional<int64_t> clientId;
+
+	auto setClientId = [&](const InsertClient::Results::Values& client) { clientId = std::get<0>(client); };
+
+	if (!m_psqlite3->query<InsertClient>(setClientId, uuidBlob))
+	{
+		// Somebody else has inserted it after our cache lookup.
+		m_psqlite3->query<SelectClientId>(setClientId, uuidBlob);
+	}
+
+	if (!clientId)
 	{
-		std::cerr << "Error: " << ex.what() << std::endl;
+		throw std::exception("Can't get client id.");
 	}
 
-	std::cout << "Client disconnected." << std::endl;
+	m_clientCache.insert(uuid, *clientId);
+
+	return *clientId;
 }
 
-void Server::saveClientPacket(const tz::ClientPacket& packet)
+void Server::registerClients(const std::vector<Uuid>& uuids, std::function<void(std::exception_ptr error)> done)
 {
-	if (packet.has_data())
+	net::post(m_registrationIoc, [this, uuids, done = std::move(done)]
 	{
-		auto& data = packet.data();
-
-		std::vector<TableColumn> columns
-		{
-			TableColumn(CLIENTS_COLUMN_ID, ColumnType::CT_INTEGER, true ),
-		};
-		WhereClause whereClause(TableValue(CLIENTS_COLUMN_UUID, data.uuid()), ComparisonType::CT_EQUAL);
+		std::exception_ptr error;
 
 		try
 		{
-			auto client = m_psqlite3->selectOne(Server::CLIENTS_TABLE_NAME, columns, &whereClause);
-
-			if (client.empty())
+			for (const auto& uuid : uuids)
 			{
-				std::vector<TableValue> values
-				{
-					TableValue(CLIENTS_COLUMN_UUID, data.uuid()),
-				};
-				m_psqlite3->insertOne(Server::CLIENTS_TABLE_NAME, values);
-
-				client = m_psqlite3->selectOne(Server::CLIENTS_TABLE_NAME, columns, &whereClause);
+				registerClient(uuid);
 			}
-
-			std::vector<TableValue> values
-			{
-				TableValue(PACKETS_COLUMN_CLIENT_ID, client.at(0).value()),
-				TableValue(PACKETS_COLUMN_TIMESTAMP, data.timestamp()    ),
-				TableValue(PACKETS_COLUMN_X,         data.x()            ),
-				TableValue(PACKETS_COLUMN_Y,         data.y()            ),
-			};
-			m_psqlite3->insertOne(Server::PACKETS_TABLE_NAME, values);
 		}
-		catch (const std::exception& ex)
+		catch (const std::exception&)
+		{
+			error = std::current_exception();
+		}
+
+		done(error);
+	});
+}
+
+std::optional<int64_t> Server::findClientId(const std::string& uuid, std::optional<int64_t> sessionClientId,
+	std::vector<Uuid>& unknownUuids)
+{
+	if (!uuid.empty())
+	{
+		auto clientUuid = Uuid::fromBytes(uuid);
+		auto clientId   = m_clientCache.find(clientUuid);
+
+		if (!clientId && std::find(unknownUuids.begin(), unknownUuids.end(), clientUuid) == unknownUuids.end())
 		{
-			std::string text = "Can't save packet: " + std::string(ex.what());
-			throw std::exception(text.c_str());
+			unknownUuids.push_back(clientUuid);
 		}
+
+		return clientId;
+	}
+
+	if (!sessionClientId)
+	{
+		throw std::exception("Packet without uuid before HELLO.");
 	}
+
+	return *sessionClientId;
+}
+
+void Server::writePoints(SQLite& sqlite3, const std::vector<StoragePoint>& points)
+{
+	sqlite3.executeMany<InsertPacket>(points, [](const StoragePoint& point)
+	{
+		return InsertPacket::Parameters::Values(point.clientId, point.timestamp, point.x, point.y);
+	});
+
+	m_windows.add(points);
+}
+
+size_t Server::pushPoints(const StoragePoint* ppoints, size_t count)
+{
+	return m_storageWriter.push(ppoints, count);
 }
 
-/*
-	Yes, I know about SQL JOINS, AVG(), ABS() and so on :)
-	For example: SELECT c.uuid, AVG(p.x) x1, SUM(ABS(p.y)) y1 FROM clients c LEFT JOIN packets p ON c.id=p.client_id GROUP BY c.uuid HAVING p.timestamp > 123;
-*/
-std::unique_ptr<tz::ServerStatistic> Server::collectStatistics()
+void Server::decodeClientColumns(const tz::ClientPacket::Columns& columns, std::optional<int64_t> sessionClientId,
+	std::vector<StoragePoint>& points, std::vector<Uuid>& unknownUuids)
 {
-	auto stats = std::make_unique<tz::ServerStatistic>();
+	int count = columns.timestamp_size();
 
-	std::vector<TableColumn> columns
+	if (columns.x_size() != count || columns.y_size() != count)
 	{
-		TableColumn(CLIENTS_COLUMN_ID,   ColumnType::CT_INTEGER, true       ),
-		TableColumn(CLIENTS_COLUMN_UUID, ColumnType::CT_TEXT,    false, true),
-	};
+		throw std::exception("Column sizes don't match.");
+	}
+
+	if (!count)
+	{
+		return;
+	}
 
-	auto clients = m_psqlite3->selectMany(Server::CLIENTS_TABLE_NAME, columns);
+	auto clientId = findClientId(columns.uuid(), sessionClientId, unknownUuids);
+	if (!clientId)
+	{
+		return;
+	}
 
-	auto currentTime = std::chrono::system_clock::now();
-	auto interval1 = (currentTime - STATS_INTERVAL_MINUTES_1).time_since_epoch().count();
-	auto interval2 = (currentTime - STATS_INTERVAL_MINUTES_2).time_since_epoch().count();
+	// The values come from the client, so they are summed as unsigned: a hostile packet wraps around
+	// into meaningless timestamps instead of overflowing a signed integer.
+	uint64_t timestamp = 0;
+	uint64_t delta     = 0;
 
-	for (const auto& client : clients)
+	for (int i = 0; i < count; ++i)
 	{
-		int64_t clientId       = std::get<int64_t>    (client.at(0).value());
-		std::string clientUuid = std::get<std::string>(client.at(1).value());
+		auto value = static_cast<uint64_t>(columns.timestamp(i));
 
-		std::vector<TableColumn> columns
+		// See tz.proto: the first value is absolute, the second a delta and the rest are delta-of-deltas.
+		if (i == 0)
 		{
-			TableColumn(PACKETS_COLUMN_TIMESTAMP, ColumnType::CT_INTEGER),
-			TableColumn(PACKETS_COLUMN_X,         ColumnType::CT_REAL   ),
-			TableColumn(PACKETS_COLUMN_Y,         ColumnType::CT_REAL   ),
-		};
-		WhereClause whereClause(TableValue(PACKETS_COLUMN_CLIENT_ID, clientId), ComparisonType::CT_EQUAL);
-		auto packets = m_psqlite3->selectMany(Server::PACKETS_TABLE_NAME, columns, &whereClause);
-
-		double sumX1 = 0;
-		double sumX5 = 0;
-		int countX1 = 0;
-		int countX5 = 0;
-		double y1 = 0;
-		double y5 = 0;
-		double avgX1 = 0;
-		double avgX5 = 0;
-		bool needToAdd1 = false;
-		bool needToAdd5 = false;
-
-		for (const auto& packet : packets)
+			timestamp = value;
+		}
+		else
 		{
-			int64_t timestamp = std::get<int64_t>(packet.at(0).value());
-			double x          = std::get<double> (packet.at(1).value());
-			double y          = std::get<double> (packet.at(2).value());
+			delta = i == 1 ? value : delta + value;
+			timestamp += delta;
+		}
+
+		points.push_back({ *clientId, static_cast<int64_t>(timestamp), columns.x(i), columns.y(i) });
+	}
+}
 
-			if (timestamp >= interval1)
+void Server::decodeClientPacket(const tz::ClientPacket& packet, std::optional<int64_t> sessionClientId,
+	std::vector<StoragePoint>& points, std::vector<Uuid>& unknownUuids)
+{
+	try
+	{
+		if (packet.has_data())
+		{
+			auto& data = packet.data();
+			if (auto clientId = findClientId(data.uuid(), sessionClientId, unknownUuids))
 			{
-				sumX1 += x;
-				++countX1;
+				points.push_back({ *clientId, data.timestamp(), data.x(), data.y() });
+			}
+		}
+
+		if (packet.has_batch())
+		{
+			// A batch normally comes from a single client, so its id is looked up once instead of per point.
+			const std::string* pLastUuid = nullptr;
+			std::optional<int64_t> clientId;
 
-				y1 += abs(y);
+			for (const auto& data : packet.batch().point())
+			{
+				if (!pLastUuid || *pLastUuid != data.uuid())
+				{
+					clientId  = findClientId(data.uuid(), sessionClientId, unknownUuids);
+					pLastUuid = &data.uuid();
+				}
 
-				needToAdd1 = true;
+				if (clientId)
+				{
+					points.push_back({ *clientId, data.timestamp(), data.x(), data.y() });
+				}
 			}
+		}
 
-			if (timestamp >= interval2)
-			{
-				sumX5 += x;
-				++countX5;
+		if (packet.has_columns())
+		{
+			decodeClientColumns(packet.columns(), sessionClientId, points, unknownUuids);
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		std::string text = "Can't save packet: " + std::string(ex.what());
+		throw std::exception(text.c_str());
+	}
+}
 
-				y5 += abs(y);
+std::vector<std::chrono::seconds> Server::statisticsWindows(const ServerConfig& config)
+{
+	auto windows = config.statisticsWindows;
 
-				needToAdd5 = true;
-			}
+	windows.push_back(STATS_INTERVAL_MINUTES_1);
+	windows.push_back(STATS_INTERVAL_MINUTES_2);
+
+	return windows;
+}
+
+// Answered from the window aggregators without touching the database. Lists the configured windows.
+tz::ServerStatistic* Server::collectStatistics(google::protobuf::Arena* pArena)
+{
+	auto& windows = m_windows.windows();
+	auto windowIndex = [&windows](std::chrono::seconds window)
+	{
+		return static_cast<size_t>(std::lower_bound(windows.begin(), windows.end(), window) - windows.begin());
+	};
+
+	// The x1/y1/x5/y5 windows come first, then the configured ones in ascending order. m_windows holds all of them
+	// sorted and without duplicates, so configured windows map to ascending, distinct indexes.
+	std::vector<size_t> windowIndexes{ windowIndex(STATS_INTERVAL_MINUTES_1), windowIndex(STATS_INTERVAL_MINUTES_2) };
+	size_t listed = windowIndexes.size();
+
+	for (auto window : m_config.statisticsWindows)
+	{
+		windowIndexes.push_back(windowIndex(window));
+	}
+
+	std::sort(windowIndexes.begin() + listed, windowIndexes.end());
+	windowIndexes.erase(std::unique(windowIndexes.begin() + listed, windowIndexes.end()), windowIndexes.end());
+
+	int64_t now = std::chrono::system_clock::now().time_since_epoch().count();
+
+	// Every worker fills its own fragment, they are merged when all are done. All of them live on pArena, which is
+	// thread-safe, so merging only moves pointers.
+	std::vector<tz::ServerStatistic*> fragments(m_statisticsPool.workerCount());
+
+	for (auto& fragment : fragments)
+	{
+		fragment = google::protobuf::Arena::CreateMessage<tz::ServerStatistic>(pArena);
+	}
+
+	m_windows.visit(now, windowIndexes, m_statisticsPool, STATS_PARALLEL_MIN_CLIENTS,
+		[&](size_t worker, int64_t clientId, const std::vector<WindowSum>& sums)
+	{
+		if (std::none_of(sums.begin(), sums.end(), [](const WindowSum& sum) { return sum.count != 0; }))
+		{
+			return;
 		}
 
-		if (needToAdd1)
+		// Every client that has stored a packet is in the cache.
+		auto clientUuid = m_clientCache.findUuid(clientId);
+		if (!clientUuid)
 		{
-			avgX1 = sumX1 / countX1;
+			return;
 		}
 
-		if (needToAdd5)
+		auto client = fragments[worker]->add_client();
+		client->set_uuid(clientUuid->data(), clientUuid->size());
+		client->set_x1(sums[0].avgX());
+		client->set_y1(sums[0].sumAbsY);
+		client->set_x5(sums[1].avgX());
+		client->set_y5(sums[1].sumAbsY);
+
+		for (size_t i = listed; i < sums.size(); ++i)
 		{
-			avgX5 = sumX5 / countX5;
+			auto window = client->add_window();
+			window->set_seconds(static_cast<uint32_t>(windows[windowIndexes[i]].count()));
+			window->set_x(sums[i].avgX());
+			window->set_y(sums[i].sumAbsY);
 		}
+	});
+
+	auto stats = fragments[0];
+	std::vector<tz::ServerStatistic::Statistic*> clients;
+
+	for (size_t worker = 1; worker < fragments.size(); ++worker)
+	{
+		auto fragmentClients = fragments[worker]->mutable_client();
 
-		if (needToAdd1 || needToAdd5)
+		clients.resize(fragmentClients->size());
+		fragmentClients->UnsafeArenaExtractSubrange(0, fragmentClients->size(), clients.data());
+
+		for (auto client : clients)
 		{
-			auto client = stats->add_client();
-			client->set_uuid(clientUuid);
-			client->set_x1(avgX1);
-			client->set_y1(y1);
-			client->set_x5(avgX5);
-			client->set_y5(y5);
+			stats->mutable_client()->UnsafeArenaAddAllocated(client);
 		}
 	}
 
 	return stats;
 }
 
-Server::Server(const std::string& port) :
+Server::Server(const std::string& port, const ServerConfig& config) :
 	m_port(port),
-	m_psqlite3(std::make_unique<SQLite>(Server::DB_NAME))
+	m_config(config),
+	m_ioc(static_cast<int>(config.threadCount)),
+	m_acceptor(net::make_strand(m_ioc)),
+	m_acceptRetryTimer(m_acceptor.get_executor()),
+	m_psqlite3(std::make_unique<SQLite>(config.databasePath, sqliteConfig(config.durability))),
+	m_readPool(config.databasePath, sqliteConfig(config.durability), config.threadCount),
+	m_registrationIoc(1),
+	m_registrationWork(net::make_work_guard(m_registrationIoc)),
+	m_windows(statisticsWindows(config), config.recentRetention, config.recentMaxPoints),
+	m_statisticsPool(config.statisticsThreads),
+	m_statistics(config.statisticsTick, [this](google::protobuf::Arena* pArena) { return collectStatistics(pArena); }),
+	m_storageWriter(std::make_unique<SQLite>(config.databasePath, sqliteConfig(config.durability)), config.storageQueueSize, config.groupCommitRows, config.groupCommitInterval,
+		[this](SQLite& sqlite3, const std::vector<StoragePoint>& points) { writePoints(sqlite3, points); })
 {
-	std::vector<TableColumn> columns
-	{
-		TableColumn(CLIENTS_COLUMN_ID,   ColumnType::CT_INTEGER, true       ),
-		TableColumn(CLIENTS_COLUMN_UUID, ColumnType::CT_TEXT,    false, true),
-	};
-	m_psqlite3->createTable(Server::CLIENTS_TABLE_NAME, columns);
+	m_psqlite3->execute<CreateTable<Clients>>();
+	m_psqlite3->execute<CreateTable<Packets>>();
+	m_psqlite3->execute<CreateIndex<Packets, Packets::ByTimestamp>>();
+
+	warmClientCache();
+	rebuildWindows();
+
+	// Started last: a constructor that throws must not leave the thread running.
+	m_registrationThread = std::thread([this] { m_registrationIoc.run(); });
+}
 
-	columns.assign(
+Server::~Server()
+{
+	// Registrations still queued are finished before the thread ends.
+	m_registrationWork.reset();
+	m_registrationThread.join();
+}
+
+void Server::warmClientCache()
+{
+	m_psqlite3->query<SelectClients>([this](const SelectClients::Results::Values& client)
 	{
-		TableColumn(PACKETS_COLUMN_ID,        ColumnType::CT_INTEGER, true),
-		TableColumn(PACKETS_COLUMN_CLIENT_ID, ColumnType::CT_INTEGER      ),
-		TableColumn(PACKETS_COLUMN_TIMESTAMP, ColumnType::CT_INTEGER      ),
-		TableColumn(PACKETS_COLUMN_X,         ColumnType::CT_REAL         ),
-		TableColumn(PACKETS_COLUMN_Y,         ColumnType::CT_REAL         ),
+		// Rows written by old versions may hold textual uuids, which fromBytes() understands too.
+		try
+		{
+			m_clientCache.insert(Uuid::fromBytes(std::get<1>(client)), std::get<0>(client));
+		}
+		catch (const std::exception&)
+		{
+		}
 	});
-	m_psqlite3->createTable(Server::PACKETS_TABLE_NAME, columns);
+
+	std::cout << "Known clients: " << m_clientCache.size() << std::endl;
+}
+
+// The windows only cover recent points, so after a restart they are filled from the packets of the longest one.
+void Server::rebuildWindows()
+{
+	auto since = (std::chrono::system_clock::now() - m_windows.longestWindow()).time_since_epoch().count();
+
+	// Streamed in chunks, so a long window doesn't need all of its packets in memory at once.
+	std::vector<StoragePoint> points;
+	points.reserve(REBUILD_CHUNK_POINTS);
+
+	size_t count = m_readPool.acquire()->query<SelectRecentPackets>([&](const SelectRecentPackets::Results::Values& packet)
+	{
+		points.push_back({ std::get<0>(packet), std::get<1>(packet), std::get<2>(packet), std::get<3>(packet) });
+
+		if (points.size() == REBUILD_CHUNK_POINTS)
+		{
+			m_windows.add(points);
+			points.clear();
+		}
+	}, static_cast<int64_t>(since));
+
+	m_windows.add(points);
+
+	std::cout << "Recent packets: " << count << std::endl;
 }
 
 void Server::start()
@@ -220,27 +485,24 @@ void Server::start()
 	auto const address = net::ip::make_address(BIND_IP_ADDRESS);
 	auto const port    = static_cast<unsigned short>(std::atoi(m_port.c_str()));
 
-	tcp::acceptor acceptor{ m_ioc, {address, port} };
-	acceptor.non_blocking(true);
+	tcp::endpoint endpoint{ address, port };
+	m_acceptor.open(endpoint.protocol());
+	m_acceptor.set_option(net::socket_base::reuse_address(true));
+	m_acceptor.bind(endpoint);
+	m_acceptor.listen(m_config.listenBacklog);
 
-	std::cout << "Server started." << std::endl;
+	m_storageWriter.start();
 
-	while (!m_needExit)
-	{
-		std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	doAccept();
 
-		try
-		{
-			tcp::socket socket{ m_ioc };
-			acceptor.accept(socket);
+	std::cout << "Server started (" << m_config.threadCount << " threads, backlog " << m_config.listenBacklog;
+	if (m_config.maxConnections) std::cout << ", max " << m_config.maxConnections << " connections";
+	std::cout << ")." << std::endl;
+	std::cout << "Window kernels: " << WindowKernels::name() << "." << std::endl;
 
-			std::cout << "Client connected from " << socket.local_endpoint().address() << ":" << socket.local_endpoint().port() << std::endl;
-
-			m_threads.emplace_back(std::thread(&Server::clientThread, this, std::move(socket)));
-		}
-		catch (const beast::system_error&)
-		{
-		}
+	for (size_t i = 0; i < m_config.threadCount; ++i)
+	{
+		m_threads.emplace_back([this] { m_ioc.run(); });
 	}
 
 	for (auto& thread : m_threads)
@@ -248,10 +510,51 @@ void Server::start()
 		thread.join();
 	}
 
+	m_threads.clear();
+
+	m_storageWriter.stop();
+
+	// Points are inserted on the writer's connection, so its misses show whether the ingest path ever prepares again.
+	auto& writer = m_storageWriter.connection();
+
+	std::cout << "Statement cache: " << m_psqlite3->statementCacheHits() << " hits, " << m_psqlite3->statementCacheMisses() << " misses"
+		<< " (writer: " << writer.statementCacheHits() << " hits, " << writer.statementCacheMisses() << " misses)." << std::endl;
 	std::cout << "Server stopped." << std::endl;
 }
 
 void Server::stop()
 {
-	m_needExit = true;
+	// Cancels the pending accept on the acceptor's strand, the acceptor is not thread-safe.
+	// Once every session is gone the I/O loop runs out of work and start() returns.
+	net::post(m_acceptor.get_executor(), [this]
+	{
+		beast::error_code ec;
+		m_acceptor.close(ec);
+		m_acceptRetryTimer.cancel();
+
+		std::vector<std::shared_ptr<Session>> sessions;
+		{
+			std::lock_guard<std::mutex> lock(m_sessionsMutex);
+			m_stopping = true;
+
+			for (const auto& [_, weakSession] : m_sessions)
+			{
+				if (auto session = weakSession.lock())
+				{
+					sessions.push_back(std::move(session));
+				}
+			}
+		}
+
+		for (const auto& session : sessions)
+		{
+			session->close();
+		}
+	});
+}
+
+size_t Server::connectionCount() const
+{
+	std::lock_guard<std::mutex> lock(m_sessionsMutex);
+	return m_sessions.size();
 }
@@ -6,14 +6,28 @@
 #include <vector>
 #include <variant>
 #include <memory>
-
-#include <boost/beast/core.hpp>
-#include <boost/beast/websocket.hpp>
-#include <boost/asio/connect.hpp>
+#include <optional>
+#include <mutex>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <exception>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
 #include "../protobuf/tz.pb.h"
 #include "SQLite.hpp"
+#include "SQLiteReadPool.hpp"
+#include "Uuid.hpp"
+#include "ClientCache.hpp"
+#include "ClientWindows.hpp"
+#include "WindowKernels.hpp"
+#include "StatisticsCache.hpp"
+#include "StorageWriter.hpp"
+#include "Session.hpp"
 
 #ifdef _DEBUG
 #	pragma comment(lib, "libprotobufd")
@@ -21,49 +35,177 @@
 #	pragma comment(lib, "libprotobuf")
 #endif
 
-namespace beast = boost::beast;         // from <boost/beast.hpp>
-namespace websocket = beast::websocket; // from <boost/beast/websocket.hpp>
-namespace net = boost::asio;            // from <boost/asio.hpp>
-using tcp = boost::asio::ip::tcp;       // from <boost/asio/ip/tcp.hpp>
+/*
+	What a committed point survives:
+	D_SAFE     - power loss. WAL with a sync on every commit.
+	D_BALANCED - a crash of the server. WAL synced only at checkpoints, bigger cache and memory-mapped reads.
+	D_FAST     - nothing is guaranteed, the OS decides when data reaches the disk.
+	All profiles use WAL, so statistics readers never block the storage writer.
+*/
+enum class Durability { D_SAFE, D_BALANCED, D_FAST };
+
+struct ServerConfig
+{
+	// Number of threads running the I/O loop. Sessions are asynchronous, so this does not depend on the number of clients.
+	size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+	// Length of the kernel queue of pending connections. A mass reconnect after a restart lands here first.
+	int listenBacklog = net::socket_base::max_listen_connections;
+
+	// Connections above this limit are closed right after accept. 0 means no limit.
+	size_t maxConnections = 0;
+
+	// Points are written in one transaction once this many are pending or the oldest has waited for groupCommitInterval.
+	size_t                    groupCommitRows     = 1000;
+	std::chrono::milliseconds groupCommitInterval = std::chrono::milliseconds(100);
+
+	// Capacity of the ring between sessions and the storage writer. When it is full sessions stop reading from their sockets.
+	size_t storageQueueSize = 64 * 1024;
+
+	// SQLite database file, created if it doesn't exist.
+	std::string databasePath = "tz.sqlite3";
+
+	Durability durability = Durability::D_SAFE;
+
+	// Windows reported in the window list of the statistics, in addition to the 1 and 5 minute windows of the
+	// x1/y1/x5/y5 fields, which are always computed but only listed when configured here.
+	std::vector<std::chrono::seconds> statisticsWindows;
+
+	// Statistics requests within this time after a computation get the same snapshot.
+	std::chrono::milliseconds statisticsTick = std::chrono::seconds(1);
+
+	// Windows up to recentRetention are computed exactly from the last recentMaxPoints points of each client
+	// kept in memory. Longer windows, and clients that send more points within them, use one-second or coarser buckets.
+	std::chrono::seconds recentRetention = std::chrono::minutes(5);
+	size_t               recentMaxPoints = 1024;
+
+	// Threads computing the statistics of many clients, the requesting I/O thread included.
+	size_t statisticsThreads = std::max(1u, std::thread::hardware_concurrency());
+};
 
 class Server
 {
+	friend class Session;
+
 	inline static const std::string BIND_IP_ADDRESS = "0.0.0.0";
 
-	inline static const std::string DB_NAME = "tz.sqlite3";
+	struct Clients
+	{
+		static constexpr std::string_view NAME = "clients";
 
-	inline static const std::string CLIENTS_TABLE_NAME = "clients";
-	inline static const std::string PACKETS_TABLE_NAME = "packets";
+		struct Id   : Column<SqlInteger> { static constexpr std::string_view NAME = "id";   static constexpr std::string_view CONSTRAINTS = " PRIMARY KEY NOT NULL"; };
+		struct Uuid : Column<SqlBlob>    { static constexpr std::string_view NAME = "uuid"; static constexpr std::string_view CONSTRAINTS = " UNIQUE NOT NULL";      };
 
-	inline static const std::string CLIENTS_COLUMN_ID   = "id";
-	inline static const std::string CLIENTS_COLUMN_UUID = "uuid";
+		using Columns = ColumnList<Id, Uuid>;
+	};
 
-	inline static const std::string PACKETS_COLUMN_ID        = "id";
-	inline static const std::string PACKETS_COLUMN_CLIENT_ID = "client_id";
-	inline static const std::string PACKETS_COLUMN_TIMESTAMP = "timestamp";
-	inline static const std::string PACKETS_COLUMN_X         = "x";
-	inline static const std::string PACKETS_COLUMN_Y         = "y";
+	struct Packets
+	{
+		static constexpr std::string_view NAME = "packets";
 
+		struct Id        : Column<SqlInteger> { static constexpr std::string_view NAME = "id"; static constexpr std::string_view CONSTRAINTS = " PRIMARY KEY NOT NULL"; };
+		struct ClientId  : Column<SqlInteger> { static constexpr std::string_view NAME = "client_id"; };
+		struct Timestamp : Column<SqlInteger> { static constexpr std::string_view NAME = "timestamp"; };
+		struct X         : Column<SqlReal>    { static constexpr std::string_view NAME = "x";         };
+		struct Y         : Column<SqlReal>    { static constexpr std::string_view NAME = "y";         };
+
+		using Columns = ColumnList<Id, ClientId, Timestamp, X, Y>;
+		using Point   = ColumnList<ClientId, Timestamp, X, Y>;
+
+		// Only the startup rebuild of the windows reads packets, as one range of recent timestamps. Indexing the
+		// timestamp alone keeps the entry every insert adds small; the rebuild reads the rest of the row from the table.
+		struct ByTimestamp
+		{
+			static constexpr std::string_view NAME = "packets_by_timestamp";
+			using Columns = ColumnList<Timestamp>;
+		};
+	};
+
+	// The statements of the hot paths and of startup. Their SQL is generated at compile time from the tables above.
+	using InsertClient        = InsertInto<Clients, ColumnList<Clients::Uuid>, true, ColumnList<Clients::Id>>;
+	using SelectClientId      = SelectFrom<Clients, ColumnList<Clients::Id>, Where<Clients::Uuid, Equal>>;
+	using SelectClients       = SelectFrom<Clients, Clients::Columns>;
+	using InsertPacket        = InsertInto<Packets, Packets::Point>;
+	using SelectRecentPackets = SelectFrom<Packets, Packets::Point, Where<Packets::Timestamp, GreaterOrEqual>>;
+
+	// Packets read per step when the windows are rebuilt at startup.
+	static const size_t REBUILD_CHUNK_POINTS = 64 * 1024;
+
+	// Below this many active clients waking the statistics workers costs more than it saves.
+	static const size_t STATS_PARALLEL_MIN_CLIENTS = 1024;
+
+	// Windows of the x1/y1 and x5/y5 fields.
 	inline static constexpr auto STATS_INTERVAL_MINUTES_1 = std::chrono::minutes(1);
 	inline static constexpr auto STATS_INTERVAL_MINUTES_2 = std::chrono::minutes(5);
 
+	inline static constexpr auto ACCEPT_RETRY_DELAY = std::chrono::milliseconds(100);
+
 	std::string              m_port;
+	ServerConfig             m_config;
+
+	// Live sessions. Declared before the I/O context: sessions still owned by it unregister themselves when it is destroyed.
+	mutable std::mutex                                   m_sessionsMutex;
+	std::unordered_map<Session*, std::weak_ptr<Session>> m_sessions;
+	// Set by stop() when it collects the sessions to close. Sessions are refused from then on.
+	bool                                                 m_stopping = false;
+
 	net::io_context          m_ioc;
+	// Runs on its own strand, so accept handlers, the retry timer and stop() never overlap.
+	tcp::acceptor            m_acceptor;
+	net::steady_timer        m_acceptRetryTimer;
 	std::unique_ptr<SQLite>  m_psqlite3;
+	// Statistics are read from here, so they neither wait for nor block the storage writer.
+	SQLiteReadPool           m_readPool;
+	ClientCache              m_clientCache;
+	// Unknown clients are inserted on their own thread, so the I/O threads never wait for the database.
+	net::io_context                                          m_registrationIoc;
+	net::executor_work_guard<net::io_context::executor_type> m_registrationWork;
+	std::thread                                              m_registrationThread;
+	// Statistics are answered from here. Declared before the storage writer, which feeds it.
+	ClientWindows            m_windows;
+	TaskPool                 m_statisticsPool;
+	StatisticsCache          m_statistics;
+	StorageWriter            m_storageWriter;
 	std::vector<std::thread> m_threads;
-	std::atomic_bool         m_needExit = false;
 
-	void clientThread(tcp::socket socket);
+	static SQLiteConfig sqliteConfig(Durability durability);
+	static std::vector<std::chrono::seconds> statisticsWindows(const ServerConfig& config);
+
+	void doAccept();
+	void onAccept(beast::error_code ec, tcp::socket socket);
+
+	// Returns false once the server is stopping.
+	bool registerSession(const std::shared_ptr<Session>& session);
+	void unregisterSession(Session* session);
 
-	void saveClientPacket(const tz::ClientPacket& packet);
-	std::unique_ptr<tz::ServerStatistic> collectStatistics();
+	void warmClientCache();
+	void rebuildWindows();
+
+	int64_t registerClient(const Uuid& uuid);
+	// Registers the clients on the registration thread and calls done with the error, if any, from there.
+	void registerClients(const std::vector<Uuid>& uuids, std::function<void(std::exception_ptr error)> done);
+	// Returns nothing for a uuid missing from the cache, which is added to unknownUuids.
+	std::optional<int64_t> findClientId(const std::string& uuid, std::optional<int64_t> sessionClientId,
+		std::vector<Uuid>& unknownUuids);
+	void writePoints(SQLite& sqlite3, const std::vector<StoragePoint>& points);
+	size_t pushPoints(const StoragePoint* ppoints, size_t count);
+
+	// Points of clients in unknownUuids are left out, the packet has to be decoded again once they are registered.
+	void decodeClientColumns(const tz::ClientPacket::Columns& columns, std::optional<int64_t> sessionClientId,
+		std::vector<StoragePoint>& points, std::vector<Uuid>& unknownUuids);
+	void decodeClientPacket(const tz::ClientPacket& packet, std::optional<int64_t> sessionClientId,
+		std::vector<StoragePoint>& points, std::vector<Uuid>& unknownUuids);
+	tz::ServerStatistic* collectStatistics(google::protobuf::Arena* pArena);
+	std::shared_ptr<const StatisticsSnapshot> statistics() { return m_statistics.get(); };
 
 public:
-	Server(const std::string& port);
-	~Server() {};
+	Server(const std::string& port, const ServerConfig& config = ServerConfig());
+	~Server();
 
 	void start();
 	void stop();
+
+	size_t connectionCount() const;
 };
 
 #endif // _SERVER_H_
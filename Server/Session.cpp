@@ -0,0 +1,244 @@
+#include "Session.hpp"
+#include "Server.hpp"
+
+void Session::onAccept(beast::error_code ec)
+{
+	if (ec)
+	{
+		std::cerr << "Handshake failed: " << ec.message() << std::endl;
+		return;
+	}
+
+	doRead();
+}
+
+void Session::doRead()
+{
+	m_buffer.clear();
+	m_ws.async_read(m_buffer, beast::bind_front_handler(&Session::onRead, shared_from_this()));
+}
+
+void Session::onRead(beast::error_code ec, size_t bytesTransferred)
+{
+	if (ec)
+	{
+		std::cerr << "Connection closed." << std::endl;
+		return;
+	}
+
+	try
+	{
+		if (handleFrame())
+		{
+			// The next read is started once the response has been written.
+			return;
+		}
+	}
+	catch (const std::bad_variant_access&)
+	{
+		std::cerr << "Invalid type from the DB." << std::endl;
+		return;
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << "Error: " << ex.what() << std::endl;
+		return;
+	}
+
+	doRead();
+}
+
+void Session::onWrite(beast::error_code ec, size_t bytesTransferred)
+{
+	m_pstatistics.reset();
+
+	if (ec)
+	{
+		std::cerr << "Connection closed." << std::endl;
+		return;
+	}
+
+	std::cout << "Statistics sent." << std::endl;
+
+	doRead();
+}
+
+bool Session::handleFrame()
+{
+	// flat_buffer is contiguous, so the packet is parsed in place without copying the frame.
+	auto data = m_buffer.cdata();
+
+	if (!m_packet.ParseFromArray(data.data(), static_cast<int>(data.size())))
+	{
+		std::cout << "Malformed packet. Ignoring..." << std::endl;
+		return false;
+	}
+
+	return handlePacket(m_packet);
+}
+
+bool Session::handlePacket(const tz::ClientPacket& packet)
+{
+	switch (packet.type())
+	{
+	case tz::ClientPacket::HELLO:
+		m_uuid = Uuid::fromBytes(packet.hello().uuid());
+		return handleHello();
+
+	case tz::ClientPacket::DATA:
+		std::cout << "Packet received: "
+			      << (packet.data().uuid().empty() ? m_uuid : Uuid::fromBytes(packet.data().uuid())) << " "
+			      << packet.data().timestamp() << " "
+			      << packet.data().x()         << " "
+			      << packet.data().y()         << std::endl;
+		return storePacket(packet);
+
+	case tz::ClientPacket::BATCH:
+		std::cout << "Batch received: " << packet.batch().point_size() << " points" << std::endl;
+		return storePacket(packet);
+
+	case tz::ClientPacket::COLUMNS:
+		std::cout << "Columns received: "
+			      << (packet.columns().uuid().empty() ? m_uuid : Uuid::fromBytes(packet.columns().uuid())) << " "
+			      << packet.columns().timestamp_size() << " points" << std::endl;
+		return storePacket(packet);
+
+	case tz::ClientPacket::STATISTICS:
+	{
+		m_pstatistics = m_server.statistics();
+
+		auto& windowSeconds = packet.statistics().window_seconds();
+		auto& bytes         = windowSeconds.empty() ? m_pstatistics->bytes : m_pstatistics->filteredBytes(windowSeconds);
+
+		m_ws.async_write(net::buffer(bytes), beast::bind_front_handler(&Session::onWrite, shared_from_this()));
+		return true;
+	}
+
+	default:
+		std::cout << "Unknown packet type. Ignoring..." << std::endl;
+	}
+
+	return false;
+}
+
+bool Session::handleHello()
+{
+	m_clientId = m_server.m_clientCache.find(m_uuid);
+
+	if (!m_clientId)
+	{
+		m_unknownUuids.assign(1, m_uuid);
+		return registerClients();
+	}
+
+	std::cout << "Hello received: " << m_uuid << std::endl;
+	return false;
+}
+
+bool Session::storePacket(const tz::ClientPacket& packet)
+{
+	m_points.clear();
+	m_pointsPushed = 0;
+	m_unknownUuids.clear();
+
+	m_server.decodeClientPacket(packet, m_clientId, m_points, m_unknownUuids);
+
+	if (!m_unknownUuids.empty())
+	{
+		return registerClients();
+	}
+
+	return pushPoints();
+}
+
+bool Session::registerClients()
+{
+	// The work guard keeps the I/O loop running while the session has no operation pending on it.
+	m_server.registerClients(m_unknownUuids, [self = shared_from_this(), work = net::make_work_guard(m_ws.get_executor())](std::exception_ptr error)
+	{
+		net::post(work.get_executor(), [self, error] { self->onRegistered(error); });
+	});
+
+	return true;
+}
+
+void Session::onRegistered(std::exception_ptr error)
+{
+	try
+	{
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+
+		// m_packet has not been touched meanwhile, the socket was not read. Its clients are in the cache now.
+		bool pending = m_packet.type() == tz::ClientPacket::HELLO ? handleHello() : storePacket(m_packet);
+		if (pending)
+		{
+			return;
+		}
+	}
+	catch (const std::exception& ex)
+	{
+		std::cerr << "Error: " << ex.what() << std::endl;
+		return;
+	}
+
+	doRead();
+}
+
+bool Session::pushPoints()
+{
+	m_pointsPushed += m_server.pushPoints(m_points.data() + m_pointsPushed, m_points.size() - m_pointsPushed);
+
+	if (m_pointsPushed < m_points.size())
+	{
+		m_pushRetryTimer.expires_after(PUSH_RETRY_DELAY);
+		m_pushRetryTimer.async_wait(beast::bind_front_handler(&Session::onPushRetry, shared_from_this()));
+		return true;
+	}
+
+	return false;
+}
+
+void Session::onPushRetry(beast::error_code ec)
+{
+	if (ec)
+	{
+		return;
+	}
+
+	if (!pushPoints())
+	{
+		doRead();
+	}
+}
+
+Session::Session(Server& server, tcp::socket socket) :
+	m_server(server),
+	m_ws(std::move(socket)),
+	m_pushRetryTimer(m_ws.get_executor())
+{
+	m_ws.binary(true);
+}
+
+Session::~Session()
+{
+	m_server.unregisterSession(this);
+
+	std::cout << "Client disconnected." << std::endl;
+}
+
+void Session::start()
+{
+	m_ws.async_accept(beast::bind_front_handler(&Session::onAccept, shared_from_this()));
+}
+
+void Session::close()
+{
+	net::post(m_ws.get_executor(), [self = shared_from_this()]
+	{
+		beast::error_code ec;
+		self->m_ws.next_layer().close(ec);
+	});
+}
@@ -0,0 +1,87 @@
+#ifndef _SESSION_H_
+#define _SESSION_H_
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <exception>
+
+#include <boost/beast/core.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+#include "../protobuf/tz.pb.h"
+#include "Uuid.hpp"
+#include "StorageWriter.hpp"
+#include "StatisticsCache.hpp"
+
+namespace beast = boost::beast;         // from <boost/beast.hpp>
+namespace websocket = beast::websocket; // from <boost/beast/websocket.hpp>
+namespace net = boost::asio;            // from <boost/asio.hpp>
+using tcp = boost::asio::ip::tcp;       // from <boost/asio/ip/tcp.hpp>
+
+class Server;
+
+/*
+	One WebSocket connection. All handlers of a session run on the strand its socket was accepted on,
+	so a session never needs its own locking. The session keeps itself alive through the pending
+	async operation and is destroyed as soon as the connection is gone, which also removes it from
+	the server's session registry.
+*/
+class Session : public std::enable_shared_from_this<Session>
+{
+	// Feeds frames to a session without a connection and counts the allocations of the receive path.
+	friend class ReceivePathTest;
+
+	inline static constexpr auto PUSH_RETRY_DELAY = std::chrono::milliseconds(5);
+
+	Server&                        m_server;
+	websocket::stream<tcp::socket> m_ws;
+	beast::flat_buffer             m_buffer;
+	// Keeps the snapshot whose bytes are being written alive until the write completes.
+	std::shared_ptr<const StatisticsSnapshot> m_pstatistics;
+
+	// Reused for every frame: once their capacity has grown to the packet size, reading a DATA packet allocates nothing.
+	tz::ClientPacket               m_packet;
+
+	// Set by HELLO. Packets without a uuid belong to this client, so it is resolved once per connection.
+	Uuid                           m_uuid;
+	std::optional<int64_t>         m_clientId;
+
+	// Uuids of the current packet missing from the client cache. The server registers them off the I/O thread,
+	// meanwhile the socket is not read; then the packet is handled again.
+	std::vector<Uuid>              m_unknownUuids;
+
+	// Points of the current packet not yet taken by the storage writer. While there are any the socket
+	// is not read, which passes the storage backpressure on to the client through TCP.
+	std::vector<StoragePoint>      m_points;
+	size_t                         m_pointsPushed = 0;
+	net::steady_timer              m_pushRetryTimer;
+
+	void onAccept(beast::error_code ec);
+	void doRead();
+	void onRead(beast::error_code ec, size_t bytesTransferred);
+	void onWrite(beast::error_code ec, size_t bytesTransferred);
+	void onPushRetry(beast::error_code ec);
+	void onRegistered(std::exception_ptr error);
+
+	// Handles the frame in m_buffer. Returns true if the session continues on its own (a response or a retry is pending).
+	bool handleFrame();
+	bool handlePacket(const tz::ClientPacket& packet);
+	bool handleHello();
+	bool storePacket(const tz::ClientPacket& packet);
+	bool pushPoints();
+	bool registerClients();
+
+public:
+	Session(Server& server, tcp::socket socket);
+	~Session();
+
+	void start();
+	void close();
+};
+
+#endif // _SESSION_H_
@@ -0,0 +1,90 @@
+#include "StatisticsCache.hpp"
+
+const std::string& StatisticsSnapshot::filteredBytes(const google::protobuf::RepeatedField<uint32_t>& windowSeconds) const
+{
+	std::vector<uint32_t> windows(windowSeconds.begin(), windowSeconds.end());
+
+	std::sort(windows.begin(), windows.end());
+	windows.erase(std::unique(windows.begin(), windows.end()), windows.end());
+
+	std::lock_guard<std::mutex> lock(filteredMutex);
+
+	auto it = filtered.find(windows);
+	if (it != filtered.end())
+	{
+		return it->second;
+	}
+
+	google::protobuf::Arena filteredArena;
+	auto pfiltered = google::protobuf::Arena::CreateMessage<tz::ServerStatistic>(&filteredArena);
+	pfiltered->set_version(pstatistics->version());
+
+	for (const auto& client : pstatistics->client())
+	{
+		auto filteredClient = pfiltered->add_client();
+		filteredClient->set_uuid(client.uuid());
+		filteredClient->set_x1(client.x1());
+		filteredClient->set_y1(client.y1());
+		filteredClient->set_x5(client.x5());
+		filteredClient->set_y5(client.y5());
+
+		for (const auto& window : client.window())
+		{
+			if (std::binary_search(windows.begin(), windows.end(), window.seconds()))
+			{
+				*filteredClient->add_window() = window;
+			}
+		}
+	}
+
+	return filtered.emplace(std::move(windows), pfiltered->SerializeAsString()).first->second;
+}
+
+StatisticsCache::StatisticsCache(std::chrono::milliseconds tick, Collector collect) :
+	m_tick(tick),
+	m_collect(std::move(collect))
+{ }
+
+std::shared_ptr<const StatisticsSnapshot> StatisticsCache::get()
+{
+	auto psnapshot = std::atomic_load(&m_psnapshot);
+
+	if (isFresh(psnapshot))
+	{
+		return psnapshot;
+	}
+
+	// Only the first request to notice recomputes. The others don't wait unless there is nothing to give them yet.
+	std::unique_lock<std::mutex> lock(m_refreshMutex, std::defer_lock);
+
+	if (psnapshot)
+	{
+		if (!lock.try_lock())
+		{
+			return psnapshot;
+		}
+	}
+	else
+		lock.lock();
+
+	psnapshot = std::atomic_load(&m_psnapshot);
+
+	if (isFresh(psnapshot))
+	{
+		return psnapshot;
+	}
+
+	auto pnext = std::make_shared<StatisticsSnapshot>();
+	pnext->version = ++m_version;
+	pnext->created = std::chrono::steady_clock::now();
+
+	auto pstatistics = m_collect(&pnext->arena);
+	pstatistics->set_version(pnext->version);
+	pstatistics->SerializeToString(&pnext->bytes);
+	pnext->pstatistics = pstatistics;
+
+	psnapshot = std::move(pnext);
+	std::atomic_store(&m_psnapshot, psnapshot);
+
+	return psnapshot;
+}
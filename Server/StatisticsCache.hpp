@@ -0,0 +1,63 @@
+#ifndef _STATISTICS_CACHE_H_
+#define _STATISTICS_CACHE_H_
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+
+#include "../protobuf/tz.pb.h"
+
+// One computation of the statistics, immutable once published. bytes is the serialized statistics.
+struct StatisticsSnapshot
+{
+	uint64_t                              version = 0;
+	std::chrono::steady_clock::time_point created;
+	google::protobuf::Arena               arena;
+	const tz::ServerStatistic*            pstatistics = nullptr;
+	std::string                           bytes;
+
+	// Serialized copies with only some of the windows, keyed by the sorted window set. The first request for a set
+	// builds it, the others within the tick write the same bytes.
+	mutable std::mutex                                         filteredMutex;
+	mutable std::map<std::vector<uint32_t>, const std::string> filtered;
+
+	// The returned bytes live as long as the snapshot.
+	const std::string& filteredBytes(const google::protobuf::RepeatedField<uint32_t>& windowSeconds) const;
+};
+
+/*
+	Statistics are recomputed at most once per tick, however many sessions ask for them: everybody within
+	the tick gets the same snapshot and writes its bytes without serializing again. A request that finds
+	the snapshot too old recomputes it while concurrent requests keep getting the previous one.
+	Snapshots are published by swapping a shared_ptr, so a reader that gets a current snapshot takes no mutex.
+*/
+class StatisticsCache
+{
+	using Collector = std::function<tz::ServerStatistic*(google::protobuf::Arena* pArena)>;
+
+	std::chrono::milliseconds m_tick;
+	Collector                 m_collect;
+
+	// Only accessed through std::atomic_load/atomic_store.
+	std::shared_ptr<const StatisticsSnapshot> m_psnapshot;
+
+	std::mutex m_refreshMutex;
+	uint64_t   m_version = 0;
+
+	bool isFresh(const std::shared_ptr<const StatisticsSnapshot>& psnapshot) const
+	{
+		return psnapshot && std::chrono::steady_clock::now() - psnapshot->created < m_tick;
+	}
+
+public:
+	StatisticsCache(std::chrono::milliseconds tick, Collector collect);
+
+	std::shared_ptr<const StatisticsSnapshot> get();
+};
+
+#endif // _STATISTICS_CACHE_H_
@@ -0,0 +1,154 @@
+#include "StorageWriter.hpp"
+
+void StorageWriter::writerThread()
+{
+	std::vector<StoragePoint> batch;
+	batch.reserve(m_batchRows);
+
+	auto batchStart = std::chrono::steady_clock::now();
+
+	for (;;)
+	{
+		// Read the flag first: everything pushed before stop() is then guaranteed to be drained below.
+		bool needExit = m_needExit;
+
+		StoragePoint point;
+		while (batch.size() < m_batchRows && m_queue.tryPop(point))
+		{
+			if (batch.empty())
+			{
+				batchStart = std::chrono::steady_clock::now();
+			}
+
+			batch.push_back(point);
+		}
+
+		if (batch.size() >= m_batchRows)
+		{
+			flush(batch);
+			continue;
+		}
+
+		if (needExit)
+		{
+			flush(batch);
+			break;
+		}
+
+		if (batch.empty())
+		{
+			waitForPoints(nullptr);
+			continue;
+		}
+
+		auto deadline = batchStart + m_batchInterval;
+
+		if (std::chrono::steady_clock::now() >= deadline)
+		{
+			flush(batch);
+			continue;
+		}
+
+		waitForPoints(&deadline);
+	}
+}
+
+void StorageWriter::waitForPoints(const std::chrono::steady_clock::time_point* pdeadline)
+{
+	std::unique_lock<std::mutex> lock(m_wakeMutex);
+
+	// Announce the wait before looking at the ring for the last time. push() does the opposite, so either it
+	// sees the flag and wakes us up, or we see its points here and don't sleep.
+	m_waiting = true;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	auto ready = [this] { return m_needExit || !m_queue.empty(); };
+
+	if (pdeadline)
+	{
+		m_wake.wait_until(lock, *pdeadline, ready);
+	}
+	else
+		m_wake.wait(lock, ready);
+
+	m_waiting = false;
+}
+
+void StorageWriter::flush(std::vector<StoragePoint>& batch)
+{
+	for (size_t attempt = 1; !batch.empty(); ++attempt)
+	{
+		try
+		{
+			m_flush(*m_psqlite3, batch);
+			batch.clear();
+		}
+		catch (const std::exception& ex)
+		{
+			std::cerr << "Can't save " << batch.size() << " points (attempt " << attempt << "): " << ex.what() << std::endl;
+
+			if (m_needExit && attempt >= STOP_FLUSH_ATTEMPTS)
+			{
+				std::cerr << "Dropping " << batch.size() << " points." << std::endl;
+				batch.clear();
+			}
+			else
+				std::this_thread::sleep_for(FLUSH_RETRY_DELAY);
+		}
+	}
+}
+
+StorageWriter::StorageWriter(std::unique_ptr<SQLite> psqlite3, size_t queueSize, size_t batchRows, std::chrono::milliseconds batchInterval,
+	FlushCallback flush) :
+	m_psqlite3(std::move(psqlite3)),
+	m_queue(queueSize),
+	m_flush(std::move(flush)),
+	m_batchRows(std::max<size_t>(1, batchRows)),
+	m_batchInterval(batchInterval)
+{ }
+
+StorageWriter::~StorageWriter()
+{
+	stop();
+}
+
+void StorageWriter::start()
+{
+	m_needExit = false;
+	m_thread = std::thread(&StorageWriter::writerThread, this);
+}
+
+void StorageWriter::stop()
+{
+	if (m_thread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_wakeMutex);
+			m_needExit = true;
+		}
+
+		m_wake.notify_one();
+		m_thread.join();
+	}
+}
+
+size_t StorageWriter::push(const StoragePoint* ppoints, size_t count)
+{
+	size_t pushed = 0;
+
+	while (pushed < count && m_queue.tryPush(ppoints[pushed]))
+	{
+		++pushed;
+	}
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (pushed && m_waiting)
+	{
+		// Taking the mutex makes sure the writer is either still checking the ring or already waiting.
+		std::lock_guard<std::mutex> lock(m_wakeMutex);
+		m_wake.notify_one();
+	}
+
+	return pushed;
+}
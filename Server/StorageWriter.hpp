@@ -0,0 +1,75 @@
+#ifndef _STORAGE_WRITER_H_
+#define _STORAGE_WRITER_H_
+
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <functional>
+
+#include "MpscQueue.hpp"
+#include "SQLite.hpp"
+
+struct StoragePoint
+{
+	int64_t clientId;
+	int64_t timestamp;
+	double  x;
+	double  y;
+};
+
+/*
+	Owns the write connection and the only thread that writes points to it. Sessions hand points over through
+	a bounded lock-free ring and never wait for the disk; when the ring is full push() takes fewer points than
+	offered and the caller has to come back later. The writer drains the ring in batches and passes each batch
+	to the flush callback, together with its connection, once it has batchRows points or the oldest point has
+	waited for batchInterval. An idle writer sleeps until a push or the batch deadline wakes it.
+*/
+class StorageWriter
+{
+	// A batch that can't be written (e.g. SQLITE_BUSY) is kept and retried, so points sessions have handed over
+	// are not lost. Meanwhile the ring fills up and sessions stop reading. After stop() the writer gives up eventually.
+	inline static constexpr auto FLUSH_RETRY_DELAY   = std::chrono::milliseconds(100);
+	static const size_t          STOP_FLUSH_ATTEMPTS = 10;
+
+	using FlushCallback = std::function<void(SQLite& sqlite3, const std::vector<StoragePoint>& points)>;
+
+	std::unique_ptr<SQLite>   m_psqlite3;
+	MpscQueue<StoragePoint>   m_queue;
+	FlushCallback             m_flush;
+	size_t                    m_batchRows;
+	std::chrono::milliseconds m_batchInterval;
+	std::thread               m_thread;
+	std::atomic_bool          m_needExit = false;
+
+	// Producers only take the mutex to wake the writer, and only while it is waiting.
+	std::mutex                m_wakeMutex;
+	std::condition_variable   m_wake;
+	std::atomic_bool          m_waiting = false;
+
+	void writerThread();
+	// Sleeps until points are pushed, stop() is called or the deadline (if any) has passed.
+	void waitForPoints(const std::chrono::steady_clock::time_point* pdeadline);
+	// Returns once the batch has been written, or dropped after STOP_FLUSH_ATTEMPTS failures during stop().
+	void flush(std::vector<StoragePoint>& batch);
+
+public:
+	StorageWriter(std::unique_ptr<SQLite> psqlite3, size_t queueSize, size_t batchRows, std::chrono::milliseconds batchInterval,
+		FlushCallback flush);
+	~StorageWriter();
+
+	void start();
+	// Writes everything that has been pushed so far and stops the writer thread.
+	void stop();
+
+	// Returns the number of points taken, which is less than count when the ring is full.
+	size_t push(const StoragePoint* ppoints, size_t count);
+
+	// The write connection, e.g. for its statement cache counters.
+	const SQLite& connection() const { return *m_psqlite3; };
+};
+
+#endif // _STORAGE_WRITER_H_
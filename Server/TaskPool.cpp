@@ -0,0 +1,92 @@
+#include "TaskPool.hpp"
+
+void TaskPool::workerThread(size_t worker)
+{
+	uint64_t generation = 0;
+
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_startCv.wait(lock, [&] { return m_needExit || m_generation != generation; });
+
+			if (m_needExit)
+			{
+				break;
+			}
+
+			generation = m_generation;
+		}
+
+		runChunks(worker);
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (!--m_running)
+		{
+			m_doneCv.notify_one();
+		}
+	}
+}
+
+void TaskPool::runChunks(size_t worker)
+{
+	for (;;)
+	{
+		size_t begin = m_nextChunk.fetch_add(m_chunkSize, std::memory_order_relaxed);
+		if (begin >= m_count)
+		{
+			break;
+		}
+
+		(*m_pfunction)(worker, begin, std::min(begin + m_chunkSize, m_count));
+	}
+}
+
+TaskPool::TaskPool(size_t workerCount)
+{
+	for (size_t worker = 1; worker < workerCount; ++worker)
+	{
+		m_threads.emplace_back(&TaskPool::workerThread, this, worker);
+	}
+}
+
+TaskPool::~TaskPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_needExit = true;
+	}
+
+	m_startCv.notify_all();
+
+	for (auto& thread : m_threads)
+	{
+		thread.join();
+	}
+}
+
+void TaskPool::parallelFor(size_t count, size_t chunkSize, const ChunkFunction& function)
+{
+	std::lock_guard<std::mutex> runLock(m_runMutex);
+
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_pfunction = &function;
+		m_count     = count;
+		m_chunkSize = std::max<size_t>(chunkSize, 1);
+		m_nextChunk = 0;
+		m_running   = m_threads.size();
+		++m_generation;
+	}
+
+	m_startCv.notify_all();
+
+	runChunks(0);
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_doneCv.wait(lock, [this] { return !m_running; });
+
+	m_pfunction = nullptr;
+}
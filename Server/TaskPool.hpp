@@ -0,0 +1,54 @@
+#ifndef _TASK_POOL_H_
+#define _TASK_POOL_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <algorithm>
+
+/*
+	Threads for splitting one CPU-bound loop across cores. parallelFor() cuts the range into chunks that idle
+	workers take from a shared cursor, so a worker that is done with cheap chunks keeps taking the chunks
+	a slower one has not reached yet. The calling thread works as worker 0, the pool threads are 1 and up.
+*/
+class TaskPool
+{
+	using ChunkFunction = std::function<void(size_t worker, size_t begin, size_t end)>;
+
+	std::vector<std::thread> m_threads;
+
+	// parallelFor() calls are serialized, the pool runs one loop at a time.
+	std::mutex m_runMutex;
+
+	std::mutex              m_mutex;
+	std::condition_variable m_startCv;
+	std::condition_variable m_doneCv;
+	uint64_t                m_generation = 0;
+	size_t                  m_running    = 0;
+	bool                    m_needExit   = false;
+
+	const ChunkFunction* m_pfunction = nullptr;
+	size_t               m_count     = 0;
+	size_t               m_chunkSize = 0;
+	std::atomic<size_t>  m_nextChunk = 0;
+
+	void workerThread(size_t worker);
+	void runChunks(size_t worker);
+
+public:
+	explicit TaskPool(size_t workerCount);
+	~TaskPool();
+
+	TaskPool(const TaskPool&) = delete;
+	TaskPool& operator=(const TaskPool&) = delete;
+
+	size_t workerCount() const { return m_threads.size() + 1; };
+
+	// Calls function for chunks of at most chunkSize of [0, count) and returns once all of them are done.
+	void parallelFor(size_t count, size_t chunkSize, const ChunkFunction& function);
+};
+
+#endif // _TASK_POOL_H_
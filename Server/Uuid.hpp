@@ -0,0 +1,121 @@
+#ifndef _UUID_H_
+#define _UUID_H_
+
+#include <string>
+#include <string_view>
+#include <ostream>
+#include <array>
+#include <cstring>
+#include <cstdint>
+#include <exception>
+
+/*
+	Client identifier as it is stored and transmitted: 16 raw bytes.
+	The 36-character textual form is only accepted from old clients and written to logs.
+*/
+class Uuid
+{
+	static const size_t SIZE      = 16;
+	static const size_t TEXT_SIZE = 36;
+
+	std::array<uint8_t, SIZE> m_bytes{};
+
+	static int hexValue(char c)
+	{
+		if (c >= '0' && c <= '9') return c - '0';
+		if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+		return -1;
+	}
+
+public:
+	Uuid() = default;
+
+	// Accepts either the 16-byte binary form or the textual "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx" one.
+	static Uuid fromBytes(const void* pdata, size_t size)
+	{
+		Uuid uuid;
+
+		if (size == SIZE)
+		{
+			std::memcpy(uuid.m_bytes.data(), pdata, SIZE);
+			return uuid;
+		}
+
+		if (size != TEXT_SIZE)
+		{
+			throw std::exception("Invalid uuid.");
+		}
+
+		auto ptext = static_cast<const char*>(pdata);
+		size_t byte = 0;
+
+		for (size_t i = 0; i < TEXT_SIZE; ++i)
+		{
+			if (i == 8 || i == 13 || i == 18 || i == 23)
+			{
+				if (ptext[i] != '-')
+				{
+					throw std::exception("Invalid uuid.");
+				}
+
+				continue;
+			}
+
+			int high = hexValue(ptext[i]);
+			int low  = hexValue(ptext[++i]);
+
+			if (high < 0 || low < 0)
+			{
+				throw std::exception("Invalid uuid.");
+			}
+
+			uuid.m_bytes[byte++] = static_cast<uint8_t>(high << 4 | low);
+		}
+
+		return uuid;
+	}
+
+	static Uuid fromBytes(std::string_view bytes) { return fromBytes(bytes.data(), bytes.size()); };
+
+	const uint8_t* data() const { return m_bytes.data(); };
+	size_t size()         const { return m_bytes.size(); };
+
+	std::string toBytes() const { return std::string(reinterpret_cast<const char*>(m_bytes.data()), m_bytes.size()); };
+
+	// Writes the textual form one character at a time, so logging a uuid builds no string.
+	friend std::ostream& operator<<(std::ostream& out, const Uuid& uuid)
+	{
+		static const char digits[] = "0123456789abcdef";
+
+		for (size_t i = 0; i < SIZE; ++i)
+		{
+			if (i == 4 || i == 6 || i == 8 || i == 10) out.put('-');
+
+			out.put(digits[uuid.m_bytes[i] >> 4]);
+			out.put(digits[uuid.m_bytes[i] & 0x0F]);
+		}
+
+		return out;
+	}
+
+	bool operator==(const Uuid& other) const { return m_bytes == other.m_bytes; };
+	bool operator!=(const Uuid& other) const { return m_bytes != other.m_bytes; };
+};
+
+// Client uuids are random, so folding the two halves is already a well distributed hash.
+struct UuidHash
+{
+	size_t operator()(const Uuid& uuid) const
+	{
+		uint64_t low  = 0;
+		uint64_t high = 0;
+
+		std::memcpy(&low,  uuid.data(),     sizeof(low));
+		std::memcpy(&high, uuid.data() + 8, sizeof(high));
+
+		return static_cast<size_t>(low ^ (high * 0x9E3779B97F4A7C15ull));
+	}
+};
+
+#endif // _UUID_H_
@@ -0,0 +1,46 @@
+#include "WindowAggregator.hpp"
+
+WindowAggregator::WindowAggregator(int64_t resolutionSeconds, size_t bucketCount) :
+	m_resolution(resolutionSeconds),
+	m_buckets(bucketCount)
+{ }
+
+void WindowAggregator::add(int64_t second, double x, double y)
+{
+	int64_t slot = second / m_resolution;
+	auto& bucket = m_buckets[static_cast<uint64_t>(slot) % m_buckets.size()];
+
+	if (bucket.slot != slot)
+	{
+		// The bucket still holds a newer slot: the point is older than the ring.
+		if (bucket.slot > slot)
+		{
+			return;
+		}
+
+		bucket.slot = slot;
+		bucket.sum  = WindowSum();
+	}
+
+	bucket.sum.sumX    += x;
+	bucket.sum.count   += 1;
+	bucket.sum.sumAbsY += y < 0 ? -y : y;
+}
+
+WindowSum WindowAggregator::sum(int64_t sinceSecond) const
+{
+	int64_t sinceSlot = sinceSecond / m_resolution;
+	WindowSum sum;
+
+	for (const auto& bucket : m_buckets)
+	{
+		if (bucket.slot >= sinceSlot)
+		{
+			sum.sumX    += bucket.sum.sumX;
+			sum.count   += bucket.sum.count;
+			sum.sumAbsY += bucket.sum.sumAbsY;
+		}
+	}
+
+	return sum;
+}
@@ -0,0 +1,49 @@
+#ifndef _WINDOW_AGGREGATOR_H_
+#define _WINDOW_AGGREGATOR_H_
+
+#include <vector>
+#include <chrono>
+#include <limits>
+#include <cstdint>
+
+struct WindowSum
+{
+	double   sumX    = 0;
+	uint64_t count   = 0;
+	double   sumAbsY = 0;
+
+	double avgX() const { return count ? sumX / count : 0; };
+};
+
+/*
+	Sliding-window sums of one client's points at one resolution: a ring of buckets of resolution seconds
+	each. Adding a point touches one bucket, and a window sum reads at most every bucket once, however many
+	points the client has sent. Windows are only as precise as the resolution.
+*/
+class WindowAggregator
+{
+	struct Bucket
+	{
+		int64_t   slot = std::numeric_limits<int64_t>::min();
+		WindowSum sum;
+	};
+
+	int64_t             m_resolution;
+	std::vector<Bucket> m_buckets;
+
+public:
+	// Timestamps are system_clock ticks since the epoch, as stored in packets.
+	static int64_t toSecond(int64_t timestamp)
+	{
+		return std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::duration(timestamp)).count();
+	}
+
+	WindowAggregator(int64_t resolutionSeconds, size_t bucketCount);
+
+	// Points older than the ring are dropped.
+	void add(int64_t second, double x, double y);
+	// Sum of the buckets from the one holding sinceSecond on.
+	WindowSum sum(int64_t sinceSecond) const;
+};
+
+#endif // _WINDOW_AGGREGATOR_H_
@@ -0,0 +1,160 @@
+#include "WindowKernels.hpp"
+
+#include <intrin.h>
+#include <immintrin.h>
+
+WindowSum WindowKernels::sumSinceScalar(const int64_t* ptimestamps, const double* px, const double* py, size_t count, int64_t since)
+{
+	WindowSum sum;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		if (ptimestamps[i] >= since)
+		{
+			sum.sumX    += px[i];
+			sum.count   += 1;
+			sum.sumAbsY += py[i] < 0 ? -py[i] : py[i];
+		}
+	}
+
+	return sum;
+}
+
+// Four points per step. Compare masks are all ones for points in the window, so they select x and |y| with an AND
+// and, subtracted, count the points.
+WindowSum WindowKernels::sumSinceAvx2(const int64_t* ptimestamps, const double* px, const double* py, size_t count, int64_t since)
+{
+	if (since == INT64_MIN)
+	{
+		return sumSinceScalar(ptimestamps, px, py, count, since);
+	}
+
+	// AVX2 only has a greater-than compare for 64-bit integers.
+	const __m256i before  = _mm256_set1_epi64x(since - 1);
+	const __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(INT64_MAX));
+
+	__m256d sumX    = _mm256_setzero_pd();
+	__m256d sumAbsY = _mm256_setzero_pd();
+	__m256i counts  = _mm256_setzero_si256();
+
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4)
+	{
+		__m256i inWindow  = _mm256_cmpgt_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptimestamps + i)), before);
+		__m256d selection = _mm256_castsi256_pd(inWindow);
+
+		sumX    = _mm256_add_pd(sumX,    _mm256_and_pd(_mm256_loadu_pd(px + i), selection));
+		sumAbsY = _mm256_add_pd(sumAbsY, _mm256_and_pd(_mm256_loadu_pd(py + i), _mm256_and_pd(absMask, selection)));
+		counts  = _mm256_sub_epi64(counts, inWindow);
+	}
+
+	alignas(32) double  lanesX[4];
+	alignas(32) double  lanesAbsY[4];
+	alignas(32) int64_t lanesCount[4];
+
+	_mm256_store_pd(lanesX, sumX);
+	_mm256_store_pd(lanesAbsY, sumAbsY);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(lanesCount), counts);
+
+	WindowSum sum = sumSinceScalar(ptimestamps + i, px + i, py + i, count - i, since);
+
+	for (int lane = 0; lane < 4; ++lane)
+	{
+		sum.sumX    += lanesX[lane];
+		sum.sumAbsY += lanesAbsY[lane];
+		sum.count   += lanesCount[lane];
+	}
+
+	return sum;
+}
+
+// Eight points per step with mask registers; the tail is loaded with a mask too, so there is no scalar loop.
+WindowSum WindowKernels::sumSinceAvx512(const int64_t* ptimestamps, const double* px, const double* py, size_t count, int64_t since)
+{
+	const __m512i start = _mm512_set1_epi64(since);
+	const __m512i one   = _mm512_set1_epi64(1);
+
+	__m512d sumX    = _mm512_setzero_pd();
+	__m512d sumAbsY = _mm512_setzero_pd();
+	__m512i counts  = _mm512_setzero_si512();
+
+	for (size_t i = 0; i < count; i += 8)
+	{
+		__mmask8 loaded = count - i >= 8 ? 0xFF : static_cast<__mmask8>((1u << (count - i)) - 1);
+
+		__mmask8 inWindow = _mm512_mask_cmpge_epi64_mask(loaded, _mm512_maskz_loadu_epi64(loaded, ptimestamps + i), start);
+
+		sumX    = _mm512_mask_add_pd(sumX,    inWindow, sumX,    _mm512_maskz_loadu_pd(inWindow, px + i));
+		sumAbsY = _mm512_mask_add_pd(sumAbsY, inWindow, sumAbsY, _mm512_abs_pd(_mm512_maskz_loadu_pd(inWindow, py + i)));
+		counts  = _mm512_mask_add_epi64(counts, inWindow, counts, one);
+	}
+
+	WindowSum sum;
+	sum.sumX    = _mm512_reduce_add_pd(sumX);
+	sum.sumAbsY = _mm512_reduce_add_pd(sumAbsY);
+	sum.count   = static_cast<uint64_t>(_mm512_reduce_add_epi64(counts));
+
+	return sum;
+}
+
+WindowKernels::SumSinceFunction WindowKernels::select(const char** pname)
+{
+	int info[4] = {};
+
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+
+	__cpuid(info, 1);
+	bool osxsave = (info[2] & (1 << 27)) != 0;
+	bool avx     = (info[2] & (1 << 28)) != 0;
+
+	// The OS has to save the YMM (and for AVX-512 the opmask and ZMM) registers on context switches.
+	unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+	bool ymmState = (xcr0 & 0x06) == 0x06;
+	bool zmmState = (xcr0 & 0xE6) == 0xE6;
+
+	bool avx2    = false;
+	bool avx512f = false;
+
+	if (maxLeaf >= 7)
+	{
+		__cpuidex(info, 7, 0);
+		avx2    = (info[1] & (1 << 5))  != 0;
+		avx512f = (info[1] & (1 << 16)) != 0;
+	}
+
+	if (avx512f && zmmState)
+	{
+		*pname = "AVX-512";
+		return sumSinceAvx512;
+	}
+
+	if (avx && avx2 && ymmState)
+	{
+		*pname = "AVX2";
+		return sumSinceAvx2;
+	}
+
+	*pname = "scalar";
+	return sumSinceScalar;
+}
+
+WindowKernels::SumSinceFunction WindowKernels::selected(const char** pname)
+{
+	static const char* name = nullptr;
+	static const SumSinceFunction pfunction = select(&name);
+
+	if (pname)
+	{
+		*pname = name;
+	}
+
+	return pfunction;
+}
+
+const char* WindowKernels::name()
+{
+	const char* name = nullptr;
+	selected(&name);
+	return name;
+}
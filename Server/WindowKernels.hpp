@@ -0,0 +1,34 @@
+#ifndef _WINDOW_KERNELS_H_
+#define _WINDOW_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "WindowAggregator.hpp"
+
+/*
+	Sum of x, count and sum of |y| of the points with timestamp >= since, over columns of timestamps, x and y.
+	The widest implementation the CPU and OS support is picked on first use: AVX-512, AVX2 or plain C++.
+*/
+class WindowKernels
+{
+	using SumSinceFunction = WindowSum(*)(const int64_t* ptimestamps, const double* px, const double* py, size_t count, int64_t since);
+
+	static WindowSum sumSinceScalar(const int64_t* ptimestamps, const double* px, const double* py, size_t count, int64_t since);
+	static WindowSum sumSinceAvx2(const int64_t* ptimestamps, const double* px, const double* py, size_t count, int64_t since);
+	static WindowSum sumSinceAvx512(const int64_t* ptimestamps, const double* px, const double* py, size_t count, int64_t since);
+
+	static SumSinceFunction select(const char** pname);
+	static SumSinceFunction selected(const char** pname = nullptr);
+
+public:
+	static WindowSum sumSince(const int64_t* ptimestamps, const double* px, const double* py, size_t count, int64_t since)
+	{
+		static const SumSinceFunction pfunction = selected();
+		return pfunction(ptimestamps, px, py, count, since);
+	}
+
+	static const char* name();
+};
+
+#endif // _WINDOW_KERNELS_H_
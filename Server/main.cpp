@@ -1,5 +1,7 @@
 #include <iostream>
 #include <csignal>
+#include <cstring>
+#include <cctype>
 
 #include "Server.hpp"
 
@@ -9,24 +11,170 @@ namespace {
 
 void printUsage()
 {
-	std::cerr << "Usage: server <port>\n"
+	std::cerr << "Usage: server <port> [--threads <count>] [--backlog <count>] [--max-connections <count>]\n"
+	          << "              [--group-commit-rows <count>] [--group-commit-ms <milliseconds>]\n"
+	          << "              [--storage-queue <points>] [--durability safe|balanced|fast]\n"
+	          << "              [--windows <length>[s|m|h|d],...] [--stats-tick-ms <milliseconds>]\n"
+	          << "              [--stats-threads <count>] [--recent-retention <seconds>] [--recent-points <count>]\n"
+	          << "              [--db <path>]\n"
 	          << "Example:\n"
-	          << "\tserver 12345\n"
+	          << "\tserver 12345 --threads 4 --backlog 4096 --max-connections 50000\n"
+	          << "\tserver 12345 --windows 10s,1m,5m,1h,24h\n"
 	          << std::endl;
 }
 
+// "10s,1m,5m,1h,24h". A length without a unit is in seconds.
+bool parseWindows(const std::string& text, std::vector<std::chrono::seconds>& windows)
+{
+	windows.clear();
+
+	size_t start = 0;
+	while (start <= text.size())
+	{
+		size_t end = text.find(',', start);
+		if (end == std::string::npos) end = text.size();
+
+		std::string item = text.substr(start, end - start);
+		start = end + 1;
+
+		size_t digits = 0;
+		while (digits < item.size() && isdigit(static_cast<unsigned char>(item[digits]))) ++digits;
+
+		if (!digits || item.size() - digits > 1)
+		{
+			return false;
+		}
+
+		long long length = std::atoll(item.substr(0, digits).c_str());
+		char unit = digits < item.size() ? item[digits] : 's';
+
+		switch (unit)
+		{
+		case 's': windows.push_back(std::chrono::seconds(length)); break;
+		case 'm': windows.push_back(std::chrono::minutes(length)); break;
+		case 'h': windows.push_back(std::chrono::hours(length));   break;
+		case 'd': windows.push_back(std::chrono::hours(length * 24)); break;
+		default:
+			return false;
+		}
+
+		if (windows.back().count() <= 0)
+		{
+			return false;
+		}
+	}
+
+	return !windows.empty();
+}
+
 int main(int argc, char* argv[])
 {
 	GOOGLE_PROTOBUF_VERIFY_VERSION;
 
 	std::cout << "Server" << std::endl << std::endl;
 
-	if (argc == 2)
+	ServerConfig config;
+	bool validArgs = argc >= 2;
+
+	for (int i = 2; validArgs && i < argc; ++i)
+	{
+		if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+		{
+			int threadCount = std::atoi(argv[++i]);
+			validArgs = threadCount > 0;
+			config.threadCount = threadCount;
+		}
+		else if (!strcmp(argv[i], "--backlog") && i + 1 < argc)
+		{
+			config.listenBacklog = std::atoi(argv[++i]);
+			validArgs = config.listenBacklog > 0;
+		}
+		else if (!strcmp(argv[i], "--max-connections") && i + 1 < argc)
+		{
+			int maxConnections = std::atoi(argv[++i]);
+			validArgs = maxConnections > 0;
+			config.maxConnections = maxConnections;
+		}
+		else if (!strcmp(argv[i], "--group-commit-rows") && i + 1 < argc)
+		{
+			int rows = std::atoi(argv[++i]);
+			validArgs = rows > 0;
+			config.groupCommitRows = rows;
+		}
+		else if (!strcmp(argv[i], "--group-commit-ms") && i + 1 < argc)
+		{
+			int interval = std::atoi(argv[++i]);
+			validArgs = interval > 0;
+			config.groupCommitInterval = std::chrono::milliseconds(interval);
+		}
+		else if (!strcmp(argv[i], "--storage-queue") && i + 1 < argc)
+		{
+			int queueSize = std::atoi(argv[++i]);
+			validArgs = queueSize > 0;
+			config.storageQueueSize = queueSize;
+		}
+		else if (!strcmp(argv[i], "--durability") && i + 1 < argc)
+		{
+			std::string durability = argv[++i];
+
+			if (durability == "safe")
+			{
+				config.durability = Durability::D_SAFE;
+			}
+			else if (durability == "balanced")
+			{
+				config.durability = Durability::D_BALANCED;
+			}
+			else if (durability == "fast")
+			{
+				config.durability = Durability::D_FAST;
+			}
+			else
+				validArgs = false;
+		}
+		else if (!strcmp(argv[i], "--windows") && i + 1 < argc)
+		{
+			validArgs = parseWindows(argv[++i], config.statisticsWindows);
+		}
+		else if (!strcmp(argv[i], "--stats-tick-ms") && i + 1 < argc)
+		{
+			int tick = std::atoi(argv[++i]);
+			validArgs = tick >= 0;
+			config.statisticsTick = std::chrono::milliseconds(tick);
+		}
+		else if (!strcmp(argv[i], "--stats-threads") && i + 1 < argc)
+		{
+			int threadCount = std::atoi(argv[++i]);
+			validArgs = threadCount > 0;
+			config.statisticsThreads = threadCount;
+		}
+		else if (!strcmp(argv[i], "--recent-retention") && i + 1 < argc)
+		{
+			int retention = std::atoi(argv[++i]);
+			validArgs = retention >= 0;
+			config.recentRetention = std::chrono::seconds(retention);
+		}
+		else if (!strcmp(argv[i], "--db") && i + 1 < argc)
+		{
+			config.databasePath = argv[++i];
+			validArgs = !config.databasePath.empty();
+		}
+		else if (!strcmp(argv[i], "--recent-points") && i + 1 < argc)
+		{
+			int points = std::atoi(argv[++i]);
+			validArgs = points > 0;
+			config.recentMaxPoints = points;
+		}
+		else
+			validArgs = false;
+	}
+
+	if (validArgs)
 	{
 		try
 		{
 			std::string port = argv[1];
-			g_pServer = std::make_unique<Server>(port);
+			g_pServer = std::make_unique<Server>(port, config);
 
 			std::signal(SIGINT, [](int signal) { if (g_pServer) g_pServer->stop(); });
 			g_pServer->start();
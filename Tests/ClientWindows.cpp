@@ -0,0 +1,62 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+
+#include "../Server/ClientWindows.hpp"
+#include "Tests.hpp"
+
+/*
+	A point far ahead of the server's clock must not cost the points of the present their place, neither
+	in the bucket rings nor in the recent points. Each case adds such a point before two valid ones, the
+	second of them a little ahead but within the tolerated clock skew.
+*/
+
+namespace {
+	const auto WINDOW = std::chrono::seconds(10);
+
+	int64_t ticks(std::chrono::system_clock::time_point time)
+	{
+		return time.time_since_epoch().count();
+	}
+
+	WindowSum sumWithFuturePoint(std::chrono::seconds recentRetention)
+	{
+		ClientWindows windows({ WINDOW }, recentRetention, 16);
+		TaskPool pool(1);
+
+		auto now = std::chrono::system_clock::now();
+		// The ring of the window has a bucket per second plus one, so this point maps to the bucket of now.
+		auto farAhead = now + (WINDOW + std::chrono::seconds(1)) * 100;
+		auto inSkew   = now + std::chrono::seconds(1);
+
+		windows.add({ { 1, ticks(farAhead), 100, 100 } });
+		windows.add({ { 1, ticks(now), 1, 1 }, { 1, ticks(inSkew), 1, 1 } });
+
+		WindowSum sum;
+		windows.visit(ticks(inSkew), { 0 }, pool, 1, [&sum](size_t, int64_t, const std::vector<WindowSum>& sums) { sum = sums[0]; });
+
+		return sum;
+	}
+}
+
+int clientWindowsTests()
+{
+	int failed = 0;
+
+	// No recent retention: the window is summed from the buckets. Otherwise from the recent points.
+	for (auto [name, recentRetention] : { std::make_pair("buckets", std::chrono::seconds(0)), std::make_pair("recent points", WINDOW) })
+	{
+		auto sum = sumWithFuturePoint(recentRetention);
+		bool ok  = sum.count == 2 && sum.sumX == 2 && sum.sumAbsY == 2;
+
+		std::cout << (ok ? "OK   " : "FAIL ") << "future point, " << name << ": " << sum.count << " points, sum x " << sum.sumX << std::endl;
+
+		if (!ok)
+		{
+			++failed;
+		}
+	}
+
+	return failed;
+}
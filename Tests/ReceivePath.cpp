@@ -0,0 +1,223 @@
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <new>
+
+#include "../Server/Server.hpp"
+#include "Tests.hpp"
+
+/*
+	Counts heap allocations of the session receive path: a frame in the session buffer is parsed into the
+	reused message, logged, decoded and pushed to the storage writer. Once buffers have grown to the packet
+	size none of this may allocate. Only the test thread is counted, and the storage writer is never started,
+	so its ring simply fills up. The server's database is a temporary file removed at the end.
+*/
+
+namespace {
+	thread_local bool   t_counting    = false;
+	thread_local size_t t_allocations = 0;
+
+	void* allocate(size_t size)
+	{
+		if (t_counting)
+		{
+			++t_allocations;
+		}
+
+		if (void* p = std::malloc(size ? size : 1))
+		{
+			return p;
+		}
+
+		throw std::bad_alloc();
+	}
+
+	// Logs of the receive path go nowhere, so they cost the formatting only.
+	class NullBuffer : public std::streambuf
+	{
+	protected:
+		int_type overflow(int_type c) override { return traits_type::not_eof(c); };
+		std::streamsize xsputn(const char*, std::streamsize count) override { return count; };
+	};
+
+	const size_t WARMUP_PACKETS    = 16;
+	const size_t MEASURED_PACKETS  = 1000;
+	const int    POINTS_PER_PACKET = 16;
+}
+
+void* operator new(size_t size)                             { return allocate(size); }
+void* operator new[](size_t size)                           { return allocate(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	try { return allocate(size); } catch (const std::bad_alloc&) { return nullptr; }
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	try { return allocate(size); } catch (const std::bad_alloc&) { return nullptr; }
+}
+void operator delete(void* p) noexcept                         { std::free(p); }
+void operator delete[](void* p) noexcept                       { std::free(p); }
+void operator delete(void* p, size_t) noexcept                 { std::free(p); }
+void operator delete[](void* p, size_t) noexcept               { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept   { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+class ReceivePathTest
+{
+	net::io_context&         m_ioc;
+	std::shared_ptr<Session> m_psession;
+
+public:
+	ReceivePathTest(Server& server, net::io_context& ioc) :
+		m_ioc(ioc),
+		m_psession(std::make_shared<Session>(server, tcp::socket(ioc)))
+	{ }
+
+	void receive(const std::string& frame)
+	{
+		auto& buffer = m_psession->m_buffer;
+
+		buffer.clear();
+		auto space = buffer.prepare(frame.size());
+		std::memcpy(space.data(), frame.data(), frame.size());
+		buffer.commit(frame.size());
+
+		if (m_psession->handleFrame())
+		{
+			if (m_psession->m_unknownUuids.empty())
+			{
+				throw std::exception("The storage ring is full.");
+			}
+
+			// A new uuid is registered by the server first. The session handles the packet again on the I/O loop,
+			// then its read of the unconnected socket fails at once.
+			m_ioc.restart();
+			m_ioc.run();
+		}
+	}
+
+	// Returns the allocations made by MEASURED_PACKETS receptions of the frame after warming up.
+	size_t allocations(const std::string& frame)
+	{
+		for (size_t i = 0; i < WARMUP_PACKETS; ++i)
+		{
+			receive(frame);
+		}
+
+		t_allocations = 0;
+		t_counting    = true;
+
+		for (size_t i = 0; i < MEASURED_PACKETS; ++i)
+		{
+			receive(frame);
+		}
+
+		t_counting = false;
+		return t_allocations;
+	}
+};
+
+int receivePathTests()
+{
+	Uuid sessionUuid = Uuid::fromBytes("32b768a8-98ad-4523-91f8-5f00a9fa813b");
+	Uuid otherUuid   = Uuid::fromBytes("5d0b1b4e-2f3c-4a57-9a43-0c2e8f6b7d19");
+
+	std::vector<std::pair<std::string, tz::ClientPacket>> packets;
+
+	{
+		tz::ClientPacket packet;
+		packet.set_type(tz::ClientPacket::DATA);
+		packet.mutable_data()->set_timestamp(1);
+		packet.mutable_data()->set_x(2);
+		packet.mutable_data()->set_y(3);
+		packets.emplace_back("DATA", packet);
+
+		packet.mutable_data()->set_uuid(otherUuid.toBytes());
+		packets.emplace_back("DATA with uuid", packet);
+	}
+
+	{
+		tz::ClientPacket packet;
+		packet.set_type(tz::ClientPacket::BATCH);
+
+		for (int i = 0; i < POINTS_PER_PACKET; ++i)
+		{
+			auto pdata = packet.mutable_batch()->add_point();
+			pdata->set_timestamp(i);
+			pdata->set_x(i);
+			pdata->set_y(i);
+		}
+
+		packets.emplace_back("BATCH", packet);
+	}
+
+	{
+		tz::ClientPacket packet;
+		packet.set_type(tz::ClientPacket::COLUMNS);
+
+		for (int i = 0; i < POINTS_PER_PACKET; ++i)
+		{
+			packet.mutable_columns()->add_timestamp(i ? 1 : 1000);
+			packet.mutable_columns()->add_x(i);
+			packet.mutable_columns()->add_y(i);
+		}
+
+		packets.emplace_back("COLUMNS", packet);
+	}
+
+	ServerConfig config;
+	config.threadCount       = 1;
+	config.statisticsThreads = 1;
+	config.storageQueueSize  = packets.size() * (WARMUP_PACKETS + MEASURED_PACKETS) * POINTS_PER_PACKET;
+
+	const auto databasePath = std::filesystem::temp_directory_path() / "tz_receive_path_test.sqlite3";
+	config.databasePath     = databasePath.string();
+
+	std::vector<std::pair<std::string, size_t>> results;
+
+	{
+		Server server("0", config);
+		net::io_context ioc;
+		ReceivePathTest test(server, ioc);
+
+		NullBuffer nullBuffer;
+		auto pcoutBuffer = std::cout.rdbuf(&nullBuffer);
+
+		tz::ClientPacket hello;
+		hello.set_type(tz::ClientPacket::HELLO);
+		hello.mutable_hello()->set_uuid(sessionUuid.toBytes());
+
+		test.receive(hello.SerializeAsString());
+
+		for (const auto& [name, packet] : packets)
+		{
+			results.emplace_back(name, test.allocations(packet.SerializeAsString()));
+		}
+
+		std::cout.rdbuf(pcoutBuffer);
+	}
+
+	for (const char* suffix : { "", "-wal", "-shm" })
+	{
+		std::error_code ec;
+		std::filesystem::remove(databasePath.string() + suffix, ec);
+	}
+
+	int failed = 0;
+
+	for (const auto& [name, allocations] : results)
+	{
+		std::cout << (allocations ? "FAIL " : "OK   ") << name << ": " << allocations << " allocations in " << MEASURED_PACKETS << " packets" << std::endl;
+
+		if (allocations)
+		{
+			++failed;
+		}
+	}
+
+	return failed;
+}
@@ -0,0 +1,8 @@
+#ifndef _TESTS_H_
+#define _TESTS_H_
+
+// Each returns the number of failed checks and prints one line per check.
+int clientWindowsTests();
+int receivePathTests();
+
+#endif // _TESTS_H_
@@ -0,0 +1,11 @@
+#include "Tests.hpp"
+
+int main()
+{
+	int failed = 0;
+
+	failed += clientWindowsTests();
+	failed += receivePathTests();
+
+	return failed;
+}
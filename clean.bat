@@ -7,3 +7,6 @@ rd /s /q "Client\x64"
 
 rd /s /q "Server\x86"
 rd /s /q "Server\x64"
+
+rd /s /q "Tests\x86"
+rd /s /q "Tests\x64"
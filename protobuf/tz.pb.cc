@@ -17,6 +17,18 @@
 
 PROTOBUF_PRAGMA_INIT_SEG
 namespace tz {
+constexpr ClientPacket_Hello::ClientPacket_Hello(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string){}
+struct ClientPacket_HelloDefaultTypeInternal {
+  constexpr ClientPacket_HelloDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ClientPacket_HelloDefaultTypeInternal() {}
+  union {
+    ClientPacket_Hello _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ClientPacket_HelloDefaultTypeInternal _ClientPacket_Hello_default_instance_;
 constexpr ClientPacket_Data::ClientPacket_Data(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
   : uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
@@ -32,9 +44,54 @@ struct ClientPacket_DataDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ClientPacket_DataDefaultTypeInternal _ClientPacket_Data_default_instance_;
+constexpr ClientPacket_Batch::ClientPacket_Batch(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : point_(){}
+struct ClientPacket_BatchDefaultTypeInternal {
+  constexpr ClientPacket_BatchDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ClientPacket_BatchDefaultTypeInternal() {}
+  union {
+    ClientPacket_Batch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ClientPacket_BatchDefaultTypeInternal _ClientPacket_Batch_default_instance_;
+constexpr ClientPacket_Columns::ClientPacket_Columns(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : timestamp_()
+  , _timestamp_cached_byte_size_(0)
+  , x_()
+  , y_()
+  , uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string){}
+struct ClientPacket_ColumnsDefaultTypeInternal {
+  constexpr ClientPacket_ColumnsDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ClientPacket_ColumnsDefaultTypeInternal() {}
+  union {
+    ClientPacket_Columns _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ClientPacket_ColumnsDefaultTypeInternal _ClientPacket_Columns_default_instance_;
+constexpr ClientPacket_StatisticsRequest::ClientPacket_StatisticsRequest(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : window_seconds_()
+  , _window_seconds_cached_byte_size_(0){}
+struct ClientPacket_StatisticsRequestDefaultTypeInternal {
+  constexpr ClientPacket_StatisticsRequestDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ClientPacket_StatisticsRequestDefaultTypeInternal() {}
+  union {
+    ClientPacket_StatisticsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ClientPacket_StatisticsRequestDefaultTypeInternal _ClientPacket_StatisticsRequest_default_instance_;
 constexpr ClientPacket::ClientPacket(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
   : data_(nullptr)
+  , batch_(nullptr)
+  , columns_(nullptr)
+  , hello_(nullptr)
+  , statistics_(nullptr)
   , type_(0)
 {}
 struct ClientPacketDefaultTypeInternal {
@@ -46,9 +103,24 @@ struct ClientPacketDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ClientPacketDefaultTypeInternal _ClientPacket_default_instance_;
+constexpr ServerStatistic_WindowStat::ServerStatistic_WindowStat(
+  ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
+  : x_(0)
+  , y_(0)
+  , seconds_(0u){}
+struct ServerStatistic_WindowStatDefaultTypeInternal {
+  constexpr ServerStatistic_WindowStatDefaultTypeInternal()
+    : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
+  ~ServerStatistic_WindowStatDefaultTypeInternal() {}
+  union {
+    ServerStatistic_WindowStat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ServerStatistic_WindowStatDefaultTypeInternal _ServerStatistic_WindowStat_default_instance_;
 constexpr ServerStatistic_Statistic::ServerStatistic_Statistic(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
+  : window_()
+  , uuid_(&::PROTOBUF_NAMESPACE_ID::internal::fixed_address_empty_string)
   , x1_(0)
   , y1_(0)
   , x5_(0)
@@ -64,7 +136,8 @@ struct ServerStatistic_StatisticDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ServerStatistic_StatisticDefaultTypeInternal _ServerStatistic_Statistic_default_instance_;
 constexpr ServerStatistic::ServerStatistic(
   ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized)
-  : client_(){}
+  : client_()
+  , version_(uint64_t{0u}){}
 struct ServerStatisticDefaultTypeInternal {
   constexpr ServerStatisticDefaultTypeInternal()
     : _instance(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{}) {}
@@ -75,11 +148,18 @@ struct ServerStatisticDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT ServerStatisticDefaultTypeInternal _ServerStatistic_default_instance_;
 }  // namespace tz
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_tz_2eproto[4];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_tz_2eproto[9];
 static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_tz_2eproto[1];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_tz_2eproto = nullptr;
 
 const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_tz_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Hello, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Hello, uuid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Data, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -90,6 +170,30 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_tz_2eproto::offsets[] PROTOBUF
   PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Data, timestamp_),
   PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Data, x_),
   PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Data, y_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Batch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Batch, point_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Columns, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Columns, uuid_),
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Columns, timestamp_),
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Columns, x_),
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_Columns, y_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_StatisticsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket_StatisticsRequest, window_seconds_),
   PROTOBUF_FIELD_OFFSET(::tz::ClientPacket, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::tz::ClientPacket, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -98,8 +202,25 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_tz_2eproto::offsets[] PROTOBUF
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::tz::ClientPacket, type_),
   PROTOBUF_FIELD_OFFSET(::tz::ClientPacket, data_),
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket, batch_),
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket, columns_),
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket, hello_),
+  PROTOBUF_FIELD_OFFSET(::tz::ClientPacket, statistics_),
   ~0u,
   0,
+  1,
+  2,
+  3,
+  4,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_WindowStat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_WindowStat, seconds_),
+  PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_WindowStat, x_),
+  PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_WindowStat, y_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_Statistic, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -111,6 +232,7 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_tz_2eproto::offsets[] PROTOBUF
   PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_Statistic, y1_),
   PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_Statistic, x5_),
   PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_Statistic, y5_),
+  PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic_Statistic, window_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -118,37 +240,63 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_tz_2eproto::offsets[] PROTOBUF
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic, client_),
+  PROTOBUF_FIELD_OFFSET(::tz::ServerStatistic, version_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::tz::ClientPacket_Data)},
-  { 10, 18, -1, sizeof(::tz::ClientPacket)},
-  { 20, -1, -1, sizeof(::tz::ServerStatistic_Statistic)},
-  { 31, -1, -1, sizeof(::tz::ServerStatistic)},
+  { 0, -1, -1, sizeof(::tz::ClientPacket_Hello)},
+  { 7, -1, -1, sizeof(::tz::ClientPacket_Data)},
+  { 17, -1, -1, sizeof(::tz::ClientPacket_Batch)},
+  { 24, -1, -1, sizeof(::tz::ClientPacket_Columns)},
+  { 34, -1, -1, sizeof(::tz::ClientPacket_StatisticsRequest)},
+  { 41, 53, -1, sizeof(::tz::ClientPacket)},
+  { 59, -1, -1, sizeof(::tz::ServerStatistic_WindowStat)},
+  { 68, -1, -1, sizeof(::tz::ServerStatistic_Statistic)},
+  { 80, -1, -1, sizeof(::tz::ServerStatistic)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ClientPacket_Hello_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ClientPacket_Data_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ClientPacket_Batch_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ClientPacket_Columns_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ClientPacket_StatisticsRequest_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ClientPacket_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ServerStatistic_WindowStat_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ServerStatistic_Statistic_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::tz::_ServerStatistic_default_instance_),
 };
 
 const char descriptor_table_protodef_tz_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\010tz.proto\022\002tz\"\323\001\n\014ClientPacket\022)\n\004type\030"
+  "\n\010tz.proto\022\002tz\"\237\005\n\014ClientPacket\022)\n\004type\030"
   "\001 \001(\0162\033.tz.ClientPacket.PacketType\022(\n\004da"
-  "ta\030\002 \001(\0132\025.tz.ClientPacket.DataH\000\210\001\001\032=\n\004"
-  "Data\022\014\n\004uuid\030\001 \001(\t\022\021\n\ttimestamp\030\002 \001(\003\022\t\n"
-  "\001x\030\003 \001(\001\022\t\n\001y\030\004 \001(\001\"&\n\nPacketType\022\010\n\004DAT"
-  "A\020\000\022\016\n\nSTATISTICS\020\001B\007\n\005_data\"\213\001\n\017ServerS"
-  "tatistic\022-\n\006client\030\001 \003(\0132\035.tz.ServerStat"
-  "istic.Statistic\032I\n\tStatistic\022\014\n\004uuid\030\001 \001"
-  "(\t\022\n\n\002x1\030\002 \001(\001\022\n\n\002y1\030\003 \001(\001\022\n\n\002x5\030\004 \001(\001\022\n"
-  "\n\002y5\030\005 \001(\001b\006proto3"
+  "ta\030\002 \001(\0132\025.tz.ClientPacket.DataH\000\210\001\001\022*\n\005"
+  "batch\030\003 \001(\0132\026.tz.ClientPacket.BatchH\001\210\001\001"
+  "\022.\n\007columns\030\004 \001(\0132\030.tz.ClientPacket.Colu"
+  "mnsH\002\210\001\001\022*\n\005hello\030\005 \001(\0132\026.tz.ClientPacke"
+  "t.HelloH\003\210\001\001\022;\n\nstatistics\030\006 \001(\0132\".tz.Cl"
+  "ientPacket.StatisticsRequestH\004\210\001\001\032\025\n\005Hel"
+  "lo\022\014\n\004uuid\030\001 \001(\014\032=\n\004Data\022\014\n\004uuid\030\001 \001(\014\022\021"
+  "\n\ttimestamp\030\002 \001(\003\022\t\n\001x\030\003 \001(\001\022\t\n\001y\030\004 \001(\001\032"
+  "-\n\005Batch\022$\n\005point\030\001 \003(\0132\025.tz.ClientPacke"
+  "t.Data\032@\n\007Columns\022\014\n\004uuid\030\001 \001(\014\022\021\n\ttimes"
+  "tamp\030\002 \003(\022\022\t\n\001x\030\003 \003(\001\022\t\n\001y\030\004 \003(\001\032+\n\021Stat"
+  "isticsRequest\022\026\n\016window_seconds\030\001 \003(\r\"I\n"
+  "\nPacketType\022\010\n\004DATA\020\000\022\016\n\nSTATISTICS\020\001\022\t\n"
+  "\005BATCH\020\002\022\013\n\007COLUMNS\020\003\022\t\n\005HELLO\020\004B\007\n\005_dat"
+  "aB\010\n\006_batchB\n\n\010_columnsB\010\n\006_helloB\r\n\013_st"
+  "atistics\"\201\002\n\017ServerStatistic\022-\n\006client\030\001"
+  " \003(\0132\035.tz.ServerStatistic.Statistic\022\017\n\007v"
+  "ersion\030\002 \001(\004\0323\n\nWindowStat\022\017\n\007seconds\030\001 "
+  "\001(\r\022\t\n\001x\030\002 \001(\001\022\t\n\001y\030\003 \001(\001\032y\n\tStatistic\022\014"
+  "\n\004uuid\030\001 \001(\014\022\n\n\002x1\030\002 \001(\001\022\n\n\002y1\030\003 \001(\001\022\n\n\002"
+  "x5\030\004 \001(\001\022\n\n\002y5\030\005 \001(\001\022.\n\006window\030\006 \003(\0132\036.t"
+  "z.ServerStatistic.WindowStatB\003\370\001\001b\006proto"
+  "3"
   ;
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_tz_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_tz_2eproto = {
-  false, false, 378, descriptor_table_protodef_tz_2eproto, "tz.proto", 
-  &descriptor_table_tz_2eproto_once, nullptr, 0, 4,
+  false, false, 961, descriptor_table_protodef_tz_2eproto, "tz.proto", 
+  &descriptor_table_tz_2eproto_once, nullptr, 0, 9,
   schemas, file_default_instances, TableStruct_tz_2eproto::offsets,
   file_level_metadata_tz_2eproto, file_level_enum_descriptors_tz_2eproto, file_level_service_descriptors_tz_2eproto,
 };
@@ -167,6 +315,9 @@ bool ClientPacket_PacketType_IsValid(int value) {
   switch (value) {
     case 0:
     case 1:
+    case 2:
+    case 3:
+    case 4:
       return true;
     default:
       return false;
@@ -176,6 +327,9 @@ bool ClientPacket_PacketType_IsValid(int value) {
 #if (__cplusplus < 201703) && (!defined(_MSC_VER) || _MSC_VER >= 1900)
 constexpr ClientPacket_PacketType ClientPacket::DATA;
 constexpr ClientPacket_PacketType ClientPacket::STATISTICS;
+constexpr ClientPacket_PacketType ClientPacket::BATCH;
+constexpr ClientPacket_PacketType ClientPacket::COLUMNS;
+constexpr ClientPacket_PacketType ClientPacket::HELLO;
 constexpr ClientPacket_PacketType ClientPacket::PacketType_MIN;
 constexpr ClientPacket_PacketType ClientPacket::PacketType_MAX;
 constexpr int ClientPacket::PacketType_ARRAYSIZE;
@@ -183,6 +337,198 @@ constexpr int ClientPacket::PacketType_ARRAYSIZE;
 
 // ===================================================================
 
+class ClientPacket_Hello::_Internal {
+ public:
+};
+
+ClientPacket_Hello::ClientPacket_Hello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor();
+  if (!is_message_owned) {
+    RegisterArenaDtor(arena);
+  }
+  // @@protoc_insertion_point(arena_constructor:tz.ClientPacket.Hello)
+}
+ClientPacket_Hello::ClientPacket_Hello(const ClientPacket_Hello& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_uuid().empty()) {
+    uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_uuid(), 
+      GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:tz.ClientPacket.Hello)
+}
+
+void ClientPacket_Hello::SharedCtor() {
+uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+ClientPacket_Hello::~ClientPacket_Hello() {
+  // @@protoc_insertion_point(destructor:tz.ClientPacket.Hello)
+  if (GetArenaForAllocation() != nullptr) return;
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+inline void ClientPacket_Hello::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void ClientPacket_Hello::ArenaDtor(void* object) {
+  ClientPacket_Hello* _this = reinterpret_cast< ClientPacket_Hello* >(object);
+  (void)_this;
+}
+void ClientPacket_Hello::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ClientPacket_Hello::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ClientPacket_Hello::Clear() {
+// @@protoc_insertion_point(message_clear_start:tz.ClientPacket.Hello)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  uuid_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientPacket_Hello::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ClientPacket_Hello::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tz.ClientPacket.Hello)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes uuid = 1;
+  if (!this->_internal_uuid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_uuid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tz.ClientPacket.Hello)
+  return target;
+}
+
+size_t ClientPacket_Hello::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tz.ClientPacket.Hello)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes uuid = 1;
+  if (!this->_internal_uuid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_uuid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientPacket_Hello::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ClientPacket_Hello::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientPacket_Hello::GetClassData() const { return &_class_data_; }
+
+void ClientPacket_Hello::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+  static_cast<ClientPacket_Hello *>(to)->MergeFrom(
+      static_cast<const ClientPacket_Hello &>(from));
+}
+
+
+void ClientPacket_Hello::MergeFrom(const ClientPacket_Hello& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tz.ClientPacket.Hello)
+  GOOGLE_DCHECK_NE(&from, this);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uuid().empty()) {
+    _internal_set_uuid(from._internal_uuid());
+  }
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientPacket_Hello::CopyFrom(const ClientPacket_Hello& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tz.ClientPacket.Hello)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientPacket_Hello::IsInitialized() const {
+  return true;
+}
+
+void ClientPacket_Hello::InternalSwap(ClientPacket_Hello* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &uuid_, lhs_arena,
+      &other->uuid_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientPacket_Hello::GetMetadata() const {
+  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+      &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
+      file_level_metadata_tz_2eproto[0]);
+}
+
+// ===================================================================
+
 class ClientPacket_Data::_Internal {
  public:
 };
@@ -259,12 +605,11 @@ const char* ClientPacket_Data::_InternalParse(const char* ptr, ::PROTOBUF_NAMESP
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string uuid = 1;
+      // bytes uuid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           auto str = _internal_mutable_uuid();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "tz.ClientPacket.Data.uuid"));
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -322,13 +667,9 @@ failure:
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string uuid = 1;
+  // bytes uuid = 1;
   if (!this->_internal_uuid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "tz.ClientPacket.Data.uuid");
-    target = stream->WriteStringMaybeAliased(
+    target = stream->WriteBytesMaybeAliased(
         1, this->_internal_uuid(), target);
   }
 
@@ -358,211 +699,1298 @@ failure:
   return target;
 }
 
-size_t ClientPacket_Data::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:tz.ClientPacket.Data)
+size_t ClientPacket_Data::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tz.ClientPacket.Data)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes uuid = 1;
+  if (!this->_internal_uuid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_uuid());
+  }
+
+  // int64 timestamp = 2;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // double x = 3;
+  if (!(this->_internal_x() <= 0 && this->_internal_x() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // double y = 4;
+  if (!(this->_internal_y() <= 0 && this->_internal_y() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientPacket_Data::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ClientPacket_Data::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientPacket_Data::GetClassData() const { return &_class_data_; }
+
+void ClientPacket_Data::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+  static_cast<ClientPacket_Data *>(to)->MergeFrom(
+      static_cast<const ClientPacket_Data &>(from));
+}
+
+
+void ClientPacket_Data::MergeFrom(const ClientPacket_Data& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tz.ClientPacket.Data)
+  GOOGLE_DCHECK_NE(&from, this);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uuid().empty()) {
+    _internal_set_uuid(from._internal_uuid());
+  }
+  if (from._internal_timestamp() != 0) {
+    _internal_set_timestamp(from._internal_timestamp());
+  }
+  if (!(from._internal_x() <= 0 && from._internal_x() >= 0)) {
+    _internal_set_x(from._internal_x());
+  }
+  if (!(from._internal_y() <= 0 && from._internal_y() >= 0)) {
+    _internal_set_y(from._internal_y());
+  }
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientPacket_Data::CopyFrom(const ClientPacket_Data& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tz.ClientPacket.Data)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientPacket_Data::IsInitialized() const {
+  return true;
+}
+
+void ClientPacket_Data::InternalSwap(ClientPacket_Data* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &uuid_, lhs_arena,
+      &other->uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClientPacket_Data, y_)
+      + sizeof(ClientPacket_Data::y_)
+      - PROTOBUF_FIELD_OFFSET(ClientPacket_Data, timestamp_)>(
+          reinterpret_cast<char*>(&timestamp_),
+          reinterpret_cast<char*>(&other->timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientPacket_Data::GetMetadata() const {
+  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+      &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
+      file_level_metadata_tz_2eproto[1]);
+}
+
+// ===================================================================
+
+class ClientPacket_Batch::_Internal {
+ public:
+};
+
+ClientPacket_Batch::ClientPacket_Batch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  point_(arena) {
+  SharedCtor();
+  if (!is_message_owned) {
+    RegisterArenaDtor(arena);
+  }
+  // @@protoc_insertion_point(arena_constructor:tz.ClientPacket.Batch)
+}
+ClientPacket_Batch::ClientPacket_Batch(const ClientPacket_Batch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      point_(from.point_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:tz.ClientPacket.Batch)
+}
+
+void ClientPacket_Batch::SharedCtor() {
+}
+
+ClientPacket_Batch::~ClientPacket_Batch() {
+  // @@protoc_insertion_point(destructor:tz.ClientPacket.Batch)
+  if (GetArenaForAllocation() != nullptr) return;
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+inline void ClientPacket_Batch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ClientPacket_Batch::ArenaDtor(void* object) {
+  ClientPacket_Batch* _this = reinterpret_cast< ClientPacket_Batch* >(object);
+  (void)_this;
+}
+void ClientPacket_Batch::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ClientPacket_Batch::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ClientPacket_Batch::Clear() {
+// @@protoc_insertion_point(message_clear_start:tz.ClientPacket.Batch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  point_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientPacket_Batch::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .tz.ClientPacket.Data point = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_point(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ClientPacket_Batch::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tz.ClientPacket.Batch)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .tz.ClientPacket.Data point = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_point_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_point(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tz.ClientPacket.Batch)
+  return target;
+}
+
+size_t ClientPacket_Batch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tz.ClientPacket.Batch)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .tz.ClientPacket.Data point = 1;
+  total_size += 1UL * this->_internal_point_size();
+  for (const auto& msg : this->point_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientPacket_Batch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ClientPacket_Batch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientPacket_Batch::GetClassData() const { return &_class_data_; }
+
+void ClientPacket_Batch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+  static_cast<ClientPacket_Batch *>(to)->MergeFrom(
+      static_cast<const ClientPacket_Batch &>(from));
+}
+
+
+void ClientPacket_Batch::MergeFrom(const ClientPacket_Batch& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tz.ClientPacket.Batch)
+  GOOGLE_DCHECK_NE(&from, this);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  point_.MergeFrom(from.point_);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientPacket_Batch::CopyFrom(const ClientPacket_Batch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tz.ClientPacket.Batch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientPacket_Batch::IsInitialized() const {
+  return true;
+}
+
+void ClientPacket_Batch::InternalSwap(ClientPacket_Batch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  point_.InternalSwap(&other->point_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientPacket_Batch::GetMetadata() const {
+  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+      &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
+      file_level_metadata_tz_2eproto[2]);
+}
+
+// ===================================================================
+
+class ClientPacket_Columns::_Internal {
+ public:
+};
+
+ClientPacket_Columns::ClientPacket_Columns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  timestamp_(arena),
+  x_(arena),
+  y_(arena) {
+  SharedCtor();
+  if (!is_message_owned) {
+    RegisterArenaDtor(arena);
+  }
+  // @@protoc_insertion_point(arena_constructor:tz.ClientPacket.Columns)
+}
+ClientPacket_Columns::ClientPacket_Columns(const ClientPacket_Columns& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      timestamp_(from.timestamp_),
+      x_(from.x_),
+      y_(from.y_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_uuid().empty()) {
+    uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_uuid(), 
+      GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:tz.ClientPacket.Columns)
+}
+
+void ClientPacket_Columns::SharedCtor() {
+uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+ClientPacket_Columns::~ClientPacket_Columns() {
+  // @@protoc_insertion_point(destructor:tz.ClientPacket.Columns)
+  if (GetArenaForAllocation() != nullptr) return;
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+inline void ClientPacket_Columns::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void ClientPacket_Columns::ArenaDtor(void* object) {
+  ClientPacket_Columns* _this = reinterpret_cast< ClientPacket_Columns* >(object);
+  (void)_this;
+}
+void ClientPacket_Columns::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ClientPacket_Columns::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ClientPacket_Columns::Clear() {
+// @@protoc_insertion_point(message_clear_start:tz.ClientPacket.Columns)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  timestamp_.Clear();
+  x_.Clear();
+  y_.Clear();
+  uuid_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientPacket_Columns::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes uuid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated sint64 timestamp = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedSInt64Parser(_internal_mutable_timestamp(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16) {
+          _internal_add_timestamp(::PROTOBUF_NAMESPACE_ID::internal::ReadVarintZigZag64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double x = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_x(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25) {
+          _internal_add_x(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double y = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_y(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 33) {
+          _internal_add_y(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ClientPacket_Columns::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tz.ClientPacket.Columns)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes uuid = 1;
+  if (!this->_internal_uuid().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_uuid(), target);
+  }
+
+  // repeated sint64 timestamp = 2;
+  {
+    int byte_size = _timestamp_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteSInt64Packed(
+          2, _internal_timestamp(), byte_size, target);
+    }
+  }
+
+  // repeated double x = 3;
+  if (this->_internal_x_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_x(), target);
+  }
+
+  // repeated double y = 4;
+  if (this->_internal_y_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_y(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tz.ClientPacket.Columns)
+  return target;
+}
+
+size_t ClientPacket_Columns::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tz.ClientPacket.Columns)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated sint64 timestamp = 2;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      SInt64Size(this->timestamp_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _timestamp_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double x = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_x_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated double y = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_y_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // bytes uuid = 1;
+  if (!this->_internal_uuid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_uuid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientPacket_Columns::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ClientPacket_Columns::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientPacket_Columns::GetClassData() const { return &_class_data_; }
+
+void ClientPacket_Columns::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+  static_cast<ClientPacket_Columns *>(to)->MergeFrom(
+      static_cast<const ClientPacket_Columns &>(from));
+}
+
+
+void ClientPacket_Columns::MergeFrom(const ClientPacket_Columns& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tz.ClientPacket.Columns)
+  GOOGLE_DCHECK_NE(&from, this);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  timestamp_.MergeFrom(from.timestamp_);
+  x_.MergeFrom(from.x_);
+  y_.MergeFrom(from.y_);
+  if (!from._internal_uuid().empty()) {
+    _internal_set_uuid(from._internal_uuid());
+  }
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientPacket_Columns::CopyFrom(const ClientPacket_Columns& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tz.ClientPacket.Columns)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientPacket_Columns::IsInitialized() const {
+  return true;
+}
+
+void ClientPacket_Columns::InternalSwap(ClientPacket_Columns* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  timestamp_.InternalSwap(&other->timestamp_);
+  x_.InternalSwap(&other->x_);
+  y_.InternalSwap(&other->y_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      &uuid_, lhs_arena,
+      &other->uuid_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientPacket_Columns::GetMetadata() const {
+  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+      &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
+      file_level_metadata_tz_2eproto[3]);
+}
+
+// ===================================================================
+
+class ClientPacket_StatisticsRequest::_Internal {
+ public:
+};
+
+ClientPacket_StatisticsRequest::ClientPacket_StatisticsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  window_seconds_(arena) {
+  SharedCtor();
+  if (!is_message_owned) {
+    RegisterArenaDtor(arena);
+  }
+  // @@protoc_insertion_point(arena_constructor:tz.ClientPacket.StatisticsRequest)
+}
+ClientPacket_StatisticsRequest::ClientPacket_StatisticsRequest(const ClientPacket_StatisticsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      window_seconds_(from.window_seconds_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:tz.ClientPacket.StatisticsRequest)
+}
+
+void ClientPacket_StatisticsRequest::SharedCtor() {
+}
+
+ClientPacket_StatisticsRequest::~ClientPacket_StatisticsRequest() {
+  // @@protoc_insertion_point(destructor:tz.ClientPacket.StatisticsRequest)
+  if (GetArenaForAllocation() != nullptr) return;
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+inline void ClientPacket_StatisticsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ClientPacket_StatisticsRequest::ArenaDtor(void* object) {
+  ClientPacket_StatisticsRequest* _this = reinterpret_cast< ClientPacket_StatisticsRequest* >(object);
+  (void)_this;
+}
+void ClientPacket_StatisticsRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ClientPacket_StatisticsRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ClientPacket_StatisticsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:tz.ClientPacket.StatisticsRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  window_seconds_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientPacket_StatisticsRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 window_seconds = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_window_seconds(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8) {
+          _internal_add_window_seconds(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ClientPacket_StatisticsRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tz.ClientPacket.StatisticsRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 window_seconds = 1;
+  {
+    int byte_size = _window_seconds_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_window_seconds(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tz.ClientPacket.StatisticsRequest)
+  return target;
+}
+
+size_t ClientPacket_StatisticsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tz.ClientPacket.StatisticsRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 window_seconds = 1;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      UInt32Size(this->window_seconds_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _window_seconds_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientPacket_StatisticsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ClientPacket_StatisticsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientPacket_StatisticsRequest::GetClassData() const { return &_class_data_; }
+
+void ClientPacket_StatisticsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+  static_cast<ClientPacket_StatisticsRequest *>(to)->MergeFrom(
+      static_cast<const ClientPacket_StatisticsRequest &>(from));
+}
+
+
+void ClientPacket_StatisticsRequest::MergeFrom(const ClientPacket_StatisticsRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tz.ClientPacket.StatisticsRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  window_seconds_.MergeFrom(from.window_seconds_);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClientPacket_StatisticsRequest::CopyFrom(const ClientPacket_StatisticsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tz.ClientPacket.StatisticsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClientPacket_StatisticsRequest::IsInitialized() const {
+  return true;
+}
+
+void ClientPacket_StatisticsRequest::InternalSwap(ClientPacket_StatisticsRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  window_seconds_.InternalSwap(&other->window_seconds_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClientPacket_StatisticsRequest::GetMetadata() const {
+  return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
+      &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
+      file_level_metadata_tz_2eproto[4]);
+}
+
+// ===================================================================
+
+class ClientPacket::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ClientPacket>()._has_bits_);
+  static const ::tz::ClientPacket_Data& data(const ClientPacket* msg);
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::tz::ClientPacket_Batch& batch(const ClientPacket* msg);
+  static void set_has_batch(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::tz::ClientPacket_Columns& columns(const ClientPacket* msg);
+  static void set_has_columns(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::tz::ClientPacket_Hello& hello(const ClientPacket* msg);
+  static void set_has_hello(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::tz::ClientPacket_StatisticsRequest& statistics(const ClientPacket* msg);
+  static void set_has_statistics(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+const ::tz::ClientPacket_Data&
+ClientPacket::_Internal::data(const ClientPacket* msg) {
+  return *msg->data_;
+}
+const ::tz::ClientPacket_Batch&
+ClientPacket::_Internal::batch(const ClientPacket* msg) {
+  return *msg->batch_;
+}
+const ::tz::ClientPacket_Columns&
+ClientPacket::_Internal::columns(const ClientPacket* msg) {
+  return *msg->columns_;
+}
+const ::tz::ClientPacket_Hello&
+ClientPacket::_Internal::hello(const ClientPacket* msg) {
+  return *msg->hello_;
+}
+const ::tz::ClientPacket_StatisticsRequest&
+ClientPacket::_Internal::statistics(const ClientPacket* msg) {
+  return *msg->statistics_;
+}
+ClientPacket::ClientPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor();
+  if (!is_message_owned) {
+    RegisterArenaDtor(arena);
+  }
+  // @@protoc_insertion_point(arena_constructor:tz.ClientPacket)
+}
+ClientPacket::ClientPacket(const ClientPacket& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_data()) {
+    data_ = new ::tz::ClientPacket_Data(*from.data_);
+  } else {
+    data_ = nullptr;
+  }
+  if (from._internal_has_batch()) {
+    batch_ = new ::tz::ClientPacket_Batch(*from.batch_);
+  } else {
+    batch_ = nullptr;
+  }
+  if (from._internal_has_columns()) {
+    columns_ = new ::tz::ClientPacket_Columns(*from.columns_);
+  } else {
+    columns_ = nullptr;
+  }
+  if (from._internal_has_hello()) {
+    hello_ = new ::tz::ClientPacket_Hello(*from.hello_);
+  } else {
+    hello_ = nullptr;
+  }
+  if (from._internal_has_statistics()) {
+    statistics_ = new ::tz::ClientPacket_StatisticsRequest(*from.statistics_);
+  } else {
+    statistics_ = nullptr;
+  }
+  type_ = from.type_;
+  // @@protoc_insertion_point(copy_constructor:tz.ClientPacket)
+}
+
+void ClientPacket::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&data_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&type_) -
+    reinterpret_cast<char*>(&data_)) + sizeof(type_));
+}
+
+ClientPacket::~ClientPacket() {
+  // @@protoc_insertion_point(destructor:tz.ClientPacket)
+  if (GetArenaForAllocation() != nullptr) return;
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+inline void ClientPacket::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete data_;
+  if (this != internal_default_instance()) delete batch_;
+  if (this != internal_default_instance()) delete columns_;
+  if (this != internal_default_instance()) delete hello_;
+  if (this != internal_default_instance()) delete statistics_;
+}
+
+void ClientPacket::ArenaDtor(void* object) {
+  ClientPacket* _this = reinterpret_cast< ClientPacket* >(object);
+  (void)_this;
+}
+void ClientPacket::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void ClientPacket::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void ClientPacket::Clear() {
+// @@protoc_insertion_point(message_clear_start:tz.ClientPacket)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(data_ != nullptr);
+      data_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(batch_ != nullptr);
+      batch_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(columns_ != nullptr);
+      columns_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(hello_ != nullptr);
+      hello_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(statistics_ != nullptr);
+      statistics_->Clear();
+    }
+  }
+  type_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClientPacket::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .tz.ClientPacket.PacketType type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::tz::ClientPacket_PacketType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tz.ClientPacket.Data data = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tz.ClientPacket.Batch batch = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tz.ClientPacket.Columns columns = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_columns(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tz.ClientPacket.Hello hello = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hello(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .tz.ClientPacket.StatisticsRequest statistics = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_statistics(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* ClientPacket::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:tz.ClientPacket)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .tz.ClientPacket.PacketType type = 1;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
+  }
+
+  // optional .tz.ClientPacket.Data data = 2;
+  if (_internal_has_data()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        2, _Internal::data(this), target, stream);
+  }
+
+  // optional .tz.ClientPacket.Batch batch = 3;
+  if (_internal_has_batch()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::batch(this), target, stream);
+  }
+
+  // optional .tz.ClientPacket.Columns columns = 4;
+  if (_internal_has_columns()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::columns(this), target, stream);
+  }
+
+  // optional .tz.ClientPacket.Hello hello = 5;
+  if (_internal_has_hello()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        5, _Internal::hello(this), target, stream);
+  }
+
+  // optional .tz.ClientPacket.StatisticsRequest statistics = 6;
+  if (_internal_has_statistics()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        6, _Internal::statistics(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:tz.ClientPacket)
+  return target;
+}
+
+size_t ClientPacket::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tz.ClientPacket)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uuid = 1;
-  if (!this->_internal_uuid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_uuid());
-  }
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional .tz.ClientPacket.Data data = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *data_);
+    }
 
-  // int64 timestamp = 2;
-  if (this->_internal_timestamp() != 0) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
-  }
+    // optional .tz.ClientPacket.Batch batch = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *batch_);
+    }
 
-  // double x = 3;
-  if (!(this->_internal_x() <= 0 && this->_internal_x() >= 0)) {
-    total_size += 1 + 8;
-  }
+    // optional .tz.ClientPacket.Columns columns = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *columns_);
+    }
 
-  // double y = 4;
-  if (!(this->_internal_y() <= 0 && this->_internal_y() >= 0)) {
-    total_size += 1 + 8;
+    // optional .tz.ClientPacket.Hello hello = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *hello_);
+    }
+
+    // optional .tz.ClientPacket.StatisticsRequest statistics = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *statistics_);
+    }
+
+  }
+  // .tz.ClientPacket.PacketType type = 1;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientPacket_Data::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientPacket::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    ClientPacket_Data::MergeImpl
+    ClientPacket::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientPacket_Data::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientPacket::GetClassData() const { return &_class_data_; }
 
-void ClientPacket_Data::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void ClientPacket::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<ClientPacket_Data *>(to)->MergeFrom(
-      static_cast<const ClientPacket_Data &>(from));
+  static_cast<ClientPacket *>(to)->MergeFrom(
+      static_cast<const ClientPacket &>(from));
 }
 
 
-void ClientPacket_Data::MergeFrom(const ClientPacket_Data& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:tz.ClientPacket.Data)
+void ClientPacket::MergeFrom(const ClientPacket& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tz.ClientPacket)
   GOOGLE_DCHECK_NE(&from, this);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_uuid().empty()) {
-    _internal_set_uuid(from._internal_uuid());
-  }
-  if (from._internal_timestamp() != 0) {
-    _internal_set_timestamp(from._internal_timestamp());
-  }
-  if (!(from._internal_x() <= 0 && from._internal_x() >= 0)) {
-    _internal_set_x(from._internal_x());
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_mutable_data()->::tz::ClientPacket_Data::MergeFrom(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_mutable_batch()->::tz::ClientPacket_Batch::MergeFrom(from._internal_batch());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _internal_mutable_columns()->::tz::ClientPacket_Columns::MergeFrom(from._internal_columns());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _internal_mutable_hello()->::tz::ClientPacket_Hello::MergeFrom(from._internal_hello());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _internal_mutable_statistics()->::tz::ClientPacket_StatisticsRequest::MergeFrom(from._internal_statistics());
+    }
   }
-  if (!(from._internal_y() <= 0 && from._internal_y() >= 0)) {
-    _internal_set_y(from._internal_y());
+  if (from._internal_type() != 0) {
+    _internal_set_type(from._internal_type());
   }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ClientPacket_Data::CopyFrom(const ClientPacket_Data& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:tz.ClientPacket.Data)
+void ClientPacket::CopyFrom(const ClientPacket& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tz.ClientPacket)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClientPacket_Data::IsInitialized() const {
+bool ClientPacket::IsInitialized() const {
   return true;
 }
 
-void ClientPacket_Data::InternalSwap(ClientPacket_Data* other) {
+void ClientPacket::InternalSwap(ClientPacket* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      &uuid_, lhs_arena,
-      &other->uuid_, rhs_arena
-  );
+  swap(_has_bits_[0], other->_has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ClientPacket_Data, y_)
-      + sizeof(ClientPacket_Data::y_)
-      - PROTOBUF_FIELD_OFFSET(ClientPacket_Data, timestamp_)>(
-          reinterpret_cast<char*>(&timestamp_),
-          reinterpret_cast<char*>(&other->timestamp_));
+      PROTOBUF_FIELD_OFFSET(ClientPacket, type_)
+      + sizeof(ClientPacket::type_)
+      - PROTOBUF_FIELD_OFFSET(ClientPacket, data_)>(
+          reinterpret_cast<char*>(&data_),
+          reinterpret_cast<char*>(&other->data_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClientPacket_Data::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ClientPacket::GetMetadata() const {
   return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
       &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
-      file_level_metadata_tz_2eproto[0]);
+      file_level_metadata_tz_2eproto[5]);
 }
 
 // ===================================================================
 
-class ClientPacket::_Internal {
+class ServerStatistic_WindowStat::_Internal {
  public:
-  using HasBits = decltype(std::declval<ClientPacket>()._has_bits_);
-  static const ::tz::ClientPacket_Data& data(const ClientPacket* msg);
-  static void set_has_data(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-const ::tz::ClientPacket_Data&
-ClientPacket::_Internal::data(const ClientPacket* msg) {
-  return *msg->data_;
-}
-ClientPacket::ClientPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ServerStatistic_WindowStat::ServerStatistic_WindowStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor();
   if (!is_message_owned) {
     RegisterArenaDtor(arena);
   }
-  // @@protoc_insertion_point(arena_constructor:tz.ClientPacket)
+  // @@protoc_insertion_point(arena_constructor:tz.ServerStatistic.WindowStat)
 }
-ClientPacket::ClientPacket(const ClientPacket& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      _has_bits_(from._has_bits_) {
+ServerStatistic_WindowStat::ServerStatistic_WindowStat(const ServerStatistic_WindowStat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_data()) {
-    data_ = new ::tz::ClientPacket_Data(*from.data_);
-  } else {
-    data_ = nullptr;
-  }
-  type_ = from.type_;
-  // @@protoc_insertion_point(copy_constructor:tz.ClientPacket)
+  ::memcpy(&x_, &from.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&seconds_) -
+    reinterpret_cast<char*>(&x_)) + sizeof(seconds_));
+  // @@protoc_insertion_point(copy_constructor:tz.ServerStatistic.WindowStat)
 }
 
-void ClientPacket::SharedCtor() {
+void ServerStatistic_WindowStat::SharedCtor() {
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&data_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&type_) -
-    reinterpret_cast<char*>(&data_)) + sizeof(type_));
+    reinterpret_cast<char*>(&x_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&seconds_) -
+    reinterpret_cast<char*>(&x_)) + sizeof(seconds_));
 }
 
-ClientPacket::~ClientPacket() {
-  // @@protoc_insertion_point(destructor:tz.ClientPacket)
+ServerStatistic_WindowStat::~ServerStatistic_WindowStat() {
+  // @@protoc_insertion_point(destructor:tz.ServerStatistic.WindowStat)
   if (GetArenaForAllocation() != nullptr) return;
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-inline void ClientPacket::SharedDtor() {
+inline void ServerStatistic_WindowStat::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete data_;
 }
 
-void ClientPacket::ArenaDtor(void* object) {
-  ClientPacket* _this = reinterpret_cast< ClientPacket* >(object);
+void ServerStatistic_WindowStat::ArenaDtor(void* object) {
+  ServerStatistic_WindowStat* _this = reinterpret_cast< ServerStatistic_WindowStat* >(object);
   (void)_this;
 }
-void ClientPacket::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void ServerStatistic_WindowStat::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void ClientPacket::SetCachedSize(int size) const {
+void ServerStatistic_WindowStat::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void ClientPacket::Clear() {
-// @@protoc_insertion_point(message_clear_start:tz.ClientPacket)
+void ServerStatistic_WindowStat::Clear() {
+// @@protoc_insertion_point(message_clear_start:tz.ServerStatistic.WindowStat)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    GOOGLE_DCHECK(data_ != nullptr);
-    data_->Clear();
-  }
-  type_ = 0;
-  _has_bits_.Clear();
+  ::memset(&x_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&seconds_) -
+      reinterpret_cast<char*>(&x_)) + sizeof(seconds_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ClientPacket::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ServerStatistic_WindowStat::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .tz.ClientPacket.PacketType type = 1;
+      // uint32 seconds = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          _internal_set_type(static_cast<::tz::ClientPacket_PacketType>(val));
         } else
           goto handle_unusual;
         continue;
-      // optional .tz.ClientPacket.Data data = 2;
+      // double x = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_data(), ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
+          x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double y = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 25)) {
+          y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
@@ -582,7 +2010,6 @@ const char* ClientPacket::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_I
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -590,115 +2017,121 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ClientPacket::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* ServerStatistic_WindowStat::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:tz.ClientPacket)
+  // @@protoc_insertion_point(serialize_to_array_start:tz.ServerStatistic.WindowStat)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .tz.ClientPacket.PacketType type = 1;
-  if (this->_internal_type() != 0) {
+  // uint32 seconds = 1;
+  if (this->_internal_seconds() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
-      1, this->_internal_type(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_seconds(), target);
   }
 
-  // optional .tz.ClientPacket.Data data = 2;
-  if (_internal_has_data()) {
+  // double x = 2;
+  if (!(this->_internal_x() <= 0 && this->_internal_x() >= 0)) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::data(this), target, stream);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_x(), target);
+  }
+
+  // double y = 3;
+  if (!(this->_internal_y() <= 0 && this->_internal_y() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(3, this->_internal_y(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:tz.ClientPacket)
+  // @@protoc_insertion_point(serialize_to_array_end:tz.ServerStatistic.WindowStat)
   return target;
 }
 
-size_t ClientPacket::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:tz.ClientPacket)
+size_t ServerStatistic_WindowStat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:tz.ServerStatistic.WindowStat)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional .tz.ClientPacket.Data data = 2;
-  cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *data_);
+  // double x = 2;
+  if (!(this->_internal_x() <= 0 && this->_internal_x() >= 0)) {
+    total_size += 1 + 8;
   }
 
-  // .tz.ClientPacket.PacketType type = 1;
-  if (this->_internal_type() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_type());
+  // double y = 3;
+  if (!(this->_internal_y() <= 0 && this->_internal_y() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 seconds = 1;
+  if (this->_internal_seconds() != 0) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32SizePlusOne(this->_internal_seconds());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClientPacket::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStatistic_WindowStat::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    ClientPacket::MergeImpl
+    ServerStatistic_WindowStat::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClientPacket::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStatistic_WindowStat::GetClassData() const { return &_class_data_; }
 
-void ClientPacket::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void ServerStatistic_WindowStat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<ClientPacket *>(to)->MergeFrom(
-      static_cast<const ClientPacket &>(from));
+  static_cast<ServerStatistic_WindowStat *>(to)->MergeFrom(
+      static_cast<const ServerStatistic_WindowStat &>(from));
 }
 
 
-void ClientPacket::MergeFrom(const ClientPacket& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:tz.ClientPacket)
+void ServerStatistic_WindowStat::MergeFrom(const ServerStatistic_WindowStat& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:tz.ServerStatistic.WindowStat)
   GOOGLE_DCHECK_NE(&from, this);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_data()) {
-    _internal_mutable_data()->::tz::ClientPacket_Data::MergeFrom(from._internal_data());
+  if (!(from._internal_x() <= 0 && from._internal_x() >= 0)) {
+    _internal_set_x(from._internal_x());
   }
-  if (from._internal_type() != 0) {
-    _internal_set_type(from._internal_type());
+  if (!(from._internal_y() <= 0 && from._internal_y() >= 0)) {
+    _internal_set_y(from._internal_y());
+  }
+  if (from._internal_seconds() != 0) {
+    _internal_set_seconds(from._internal_seconds());
   }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ClientPacket::CopyFrom(const ClientPacket& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:tz.ClientPacket)
+void ServerStatistic_WindowStat::CopyFrom(const ServerStatistic_WindowStat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:tz.ServerStatistic.WindowStat)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ClientPacket::IsInitialized() const {
+bool ServerStatistic_WindowStat::IsInitialized() const {
   return true;
 }
 
-void ClientPacket::InternalSwap(ClientPacket* other) {
+void ServerStatistic_WindowStat::InternalSwap(ServerStatistic_WindowStat* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ClientPacket, type_)
-      + sizeof(ClientPacket::type_)
-      - PROTOBUF_FIELD_OFFSET(ClientPacket, data_)>(
-          reinterpret_cast<char*>(&data_),
-          reinterpret_cast<char*>(&other->data_));
+      PROTOBUF_FIELD_OFFSET(ServerStatistic_WindowStat, seconds_)
+      + sizeof(ServerStatistic_WindowStat::seconds_)
+      - PROTOBUF_FIELD_OFFSET(ServerStatistic_WindowStat, x_)>(
+          reinterpret_cast<char*>(&x_),
+          reinterpret_cast<char*>(&other->x_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ClientPacket::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistic_WindowStat::GetMetadata() const {
   return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
       &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
-      file_level_metadata_tz_2eproto[1]);
+      file_level_metadata_tz_2eproto[6]);
 }
 
 // ===================================================================
@@ -709,7 +2142,8 @@ class ServerStatistic_Statistic::_Internal {
 
 ServerStatistic_Statistic::ServerStatistic_Statistic(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  window_(arena) {
   SharedCtor();
   if (!is_message_owned) {
     RegisterArenaDtor(arena);
@@ -717,7 +2151,8 @@ ServerStatistic_Statistic::ServerStatistic_Statistic(::PROTOBUF_NAMESPACE_ID::Ar
   // @@protoc_insertion_point(arena_constructor:tz.ServerStatistic.Statistic)
 }
 ServerStatistic_Statistic::ServerStatistic_Statistic(const ServerStatistic_Statistic& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      window_(from.window_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   if (!from._internal_uuid().empty()) {
@@ -766,6 +2201,7 @@ void ServerStatistic_Statistic::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  window_.Clear();
   uuid_.ClearToEmpty();
   ::memset(&x1_, 0, static_cast<size_t>(
       reinterpret_cast<char*>(&y5_) -
@@ -779,12 +2215,11 @@ const char* ServerStatistic_Statistic::_InternalParse(const char* ptr, ::PROTOBU
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string uuid = 1;
+      // bytes uuid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
           auto str = _internal_mutable_uuid();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "tz.ServerStatistic.Statistic.uuid"));
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -821,6 +2256,19 @@ const char* ServerStatistic_Statistic::_InternalParse(const char* ptr, ::PROTOBU
         } else
           goto handle_unusual;
         continue;
+      // repeated .tz.ServerStatistic.WindowStat window = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_window(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -850,13 +2298,9 @@ failure:
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string uuid = 1;
+  // bytes uuid = 1;
   if (!this->_internal_uuid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "tz.ServerStatistic.Statistic.uuid");
-    target = stream->WriteStringMaybeAliased(
+    target = stream->WriteBytesMaybeAliased(
         1, this->_internal_uuid(), target);
   }
 
@@ -884,6 +2328,14 @@ failure:
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(5, this->_internal_y5(), target);
   }
 
+  // repeated .tz.ServerStatistic.WindowStat window = 6;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_window_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, this->_internal_window(i), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -900,10 +2352,17 @@ size_t ServerStatistic_Statistic::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uuid = 1;
+  // repeated .tz.ServerStatistic.WindowStat window = 6;
+  total_size += 1UL * this->_internal_window_size();
+  for (const auto& msg : this->window_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // bytes uuid = 1;
   if (!this->_internal_uuid().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_uuid());
   }
 
@@ -949,6 +2408,7 @@ void ServerStatistic_Statistic::MergeFrom(const ServerStatistic_Statistic& from)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
+  window_.MergeFrom(from.window_);
   if (!from._internal_uuid().empty()) {
     _internal_set_uuid(from._internal_uuid());
   }
@@ -983,6 +2443,7 @@ void ServerStatistic_Statistic::InternalSwap(ServerStatistic_Statistic* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  window_.InternalSwap(&other->window_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       &uuid_, lhs_arena,
@@ -999,7 +2460,7 @@ void ServerStatistic_Statistic::InternalSwap(ServerStatistic_Statistic* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistic_Statistic::GetMetadata() const {
   return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
       &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
-      file_level_metadata_tz_2eproto[2]);
+      file_level_metadata_tz_2eproto[7]);
 }
 
 // ===================================================================
@@ -1022,10 +2483,12 @@ ServerStatistic::ServerStatistic(const ServerStatistic& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       client_(from.client_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  version_ = from.version_;
   // @@protoc_insertion_point(copy_constructor:tz.ServerStatistic)
 }
 
 void ServerStatistic::SharedCtor() {
+version_ = uint64_t{0u};
 }
 
 ServerStatistic::~ServerStatistic() {
@@ -1056,6 +2519,7 @@ void ServerStatistic::Clear() {
   (void) cached_has_bits;
 
   client_.Clear();
+  version_ = uint64_t{0u};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1078,6 +2542,14 @@ const char* ServerStatistic::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
         } else
           goto handle_unusual;
         continue;
+      // uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1115,6 +2587,12 @@ failure:
       InternalWriteMessage(1, this->_internal_client(i), target, stream);
   }
 
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1138,6 +2616,11 @@ size_t ServerStatistic::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
@@ -1161,6 +2644,9 @@ void ServerStatistic::MergeFrom(const ServerStatistic& from) {
   (void) cached_has_bits;
 
   client_.MergeFrom(from.client_);
+  if (from._internal_version() != 0) {
+    _internal_set_version(from._internal_version());
+  }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1179,23 +2665,39 @@ void ServerStatistic::InternalSwap(ServerStatistic* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   client_.InternalSwap(&other->client_);
+  swap(version_, other->version_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ServerStatistic::GetMetadata() const {
   return ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(
       &descriptor_table_tz_2eproto_getter, &descriptor_table_tz_2eproto_once,
-      file_level_metadata_tz_2eproto[3]);
+      file_level_metadata_tz_2eproto[8]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace tz
 PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::tz::ClientPacket_Hello* Arena::CreateMaybeMessage< ::tz::ClientPacket_Hello >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tz::ClientPacket_Hello >(arena);
+}
 template<> PROTOBUF_NOINLINE ::tz::ClientPacket_Data* Arena::CreateMaybeMessage< ::tz::ClientPacket_Data >(Arena* arena) {
   return Arena::CreateMessageInternal< ::tz::ClientPacket_Data >(arena);
 }
+template<> PROTOBUF_NOINLINE ::tz::ClientPacket_Batch* Arena::CreateMaybeMessage< ::tz::ClientPacket_Batch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tz::ClientPacket_Batch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tz::ClientPacket_Columns* Arena::CreateMaybeMessage< ::tz::ClientPacket_Columns >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tz::ClientPacket_Columns >(arena);
+}
+template<> PROTOBUF_NOINLINE ::tz::ClientPacket_StatisticsRequest* Arena::CreateMaybeMessage< ::tz::ClientPacket_StatisticsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tz::ClientPacket_StatisticsRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::tz::ClientPacket* Arena::CreateMaybeMessage< ::tz::ClientPacket >(Arena* arena) {
   return Arena::CreateMessageInternal< ::tz::ClientPacket >(arena);
 }
+template<> PROTOBUF_NOINLINE ::tz::ServerStatistic_WindowStat* Arena::CreateMaybeMessage< ::tz::ServerStatistic_WindowStat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::tz::ServerStatistic_WindowStat >(arena);
+}
 template<> PROTOBUF_NOINLINE ::tz::ServerStatistic_Statistic* Arena::CreateMaybeMessage< ::tz::ServerStatistic_Statistic >(Arena* arena) {
   return Arena::CreateMessageInternal< ::tz::ServerStatistic_Statistic >(arena);
 }
@@ -47,7 +47,7 @@ struct TableStruct_tz_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[4]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[9]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -58,33 +58,56 @@ namespace tz {
 class ClientPacket;
 struct ClientPacketDefaultTypeInternal;
 extern ClientPacketDefaultTypeInternal _ClientPacket_default_instance_;
+class ClientPacket_Batch;
+struct ClientPacket_BatchDefaultTypeInternal;
+extern ClientPacket_BatchDefaultTypeInternal _ClientPacket_Batch_default_instance_;
+class ClientPacket_Columns;
+struct ClientPacket_ColumnsDefaultTypeInternal;
+extern ClientPacket_ColumnsDefaultTypeInternal _ClientPacket_Columns_default_instance_;
 class ClientPacket_Data;
 struct ClientPacket_DataDefaultTypeInternal;
 extern ClientPacket_DataDefaultTypeInternal _ClientPacket_Data_default_instance_;
+class ClientPacket_Hello;
+struct ClientPacket_HelloDefaultTypeInternal;
+extern ClientPacket_HelloDefaultTypeInternal _ClientPacket_Hello_default_instance_;
+class ClientPacket_StatisticsRequest;
+struct ClientPacket_StatisticsRequestDefaultTypeInternal;
+extern ClientPacket_StatisticsRequestDefaultTypeInternal _ClientPacket_StatisticsRequest_default_instance_;
 class ServerStatistic;
 struct ServerStatisticDefaultTypeInternal;
 extern ServerStatisticDefaultTypeInternal _ServerStatistic_default_instance_;
 class ServerStatistic_Statistic;
 struct ServerStatistic_StatisticDefaultTypeInternal;
 extern ServerStatistic_StatisticDefaultTypeInternal _ServerStatistic_Statistic_default_instance_;
+class ServerStatistic_WindowStat;
+struct ServerStatistic_WindowStatDefaultTypeInternal;
+extern ServerStatistic_WindowStatDefaultTypeInternal _ServerStatistic_WindowStat_default_instance_;
 }  // namespace tz
 PROTOBUF_NAMESPACE_OPEN
 template<> ::tz::ClientPacket* Arena::CreateMaybeMessage<::tz::ClientPacket>(Arena*);
+template<> ::tz::ClientPacket_Batch* Arena::CreateMaybeMessage<::tz::ClientPacket_Batch>(Arena*);
+template<> ::tz::ClientPacket_Columns* Arena::CreateMaybeMessage<::tz::ClientPacket_Columns>(Arena*);
 template<> ::tz::ClientPacket_Data* Arena::CreateMaybeMessage<::tz::ClientPacket_Data>(Arena*);
+template<> ::tz::ClientPacket_Hello* Arena::CreateMaybeMessage<::tz::ClientPacket_Hello>(Arena*);
+template<> ::tz::ClientPacket_StatisticsRequest* Arena::CreateMaybeMessage<::tz::ClientPacket_StatisticsRequest>(Arena*);
 template<> ::tz::ServerStatistic* Arena::CreateMaybeMessage<::tz::ServerStatistic>(Arena*);
 template<> ::tz::ServerStatistic_Statistic* Arena::CreateMaybeMessage<::tz::ServerStatistic_Statistic>(Arena*);
+template<> ::tz::ServerStatistic_WindowStat* Arena::CreateMaybeMessage<::tz::ServerStatistic_WindowStat>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace tz {
 
 enum ClientPacket_PacketType : int {
   ClientPacket_PacketType_DATA = 0,
   ClientPacket_PacketType_STATISTICS = 1,
+  ClientPacket_PacketType_BATCH = 2,
+  ClientPacket_PacketType_COLUMNS = 3,
+  ClientPacket_PacketType_HELLO = 4,
   ClientPacket_PacketType_ClientPacket_PacketType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
   ClientPacket_PacketType_ClientPacket_PacketType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
 };
 bool ClientPacket_PacketType_IsValid(int value);
 constexpr ClientPacket_PacketType ClientPacket_PacketType_PacketType_MIN = ClientPacket_PacketType_DATA;
-constexpr ClientPacket_PacketType ClientPacket_PacketType_PacketType_MAX = ClientPacket_PacketType_STATISTICS;
+constexpr ClientPacket_PacketType ClientPacket_PacketType_PacketType_MAX = ClientPacket_PacketType_HELLO;
 constexpr int ClientPacket_PacketType_PacketType_ARRAYSIZE = ClientPacket_PacketType_PacketType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ClientPacket_PacketType_descriptor();
@@ -103,6 +126,154 @@ inline bool ClientPacket_PacketType_Parse(
 }
 // ===================================================================
 
+class ClientPacket_Hello final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ClientPacket.Hello) */ {
+ public:
+  inline ClientPacket_Hello() : ClientPacket_Hello(nullptr) {}
+  ~ClientPacket_Hello() override;
+  explicit constexpr ClientPacket_Hello(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientPacket_Hello(const ClientPacket_Hello& from);
+  ClientPacket_Hello(ClientPacket_Hello&& from) noexcept
+    : ClientPacket_Hello() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientPacket_Hello& operator=(const ClientPacket_Hello& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientPacket_Hello& operator=(ClientPacket_Hello&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientPacket_Hello& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientPacket_Hello* internal_default_instance() {
+    return reinterpret_cast<const ClientPacket_Hello*>(
+               &_ClientPacket_Hello_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(ClientPacket_Hello& a, ClientPacket_Hello& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientPacket_Hello* other) {
+    if (other == this) return;
+    if (GetOwningArena() == other->GetOwningArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientPacket_Hello* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ClientPacket_Hello* New() const final {
+    return new ClientPacket_Hello();
+  }
+
+  ClientPacket_Hello* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ClientPacket_Hello>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientPacket_Hello& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom(const ClientPacket_Hello& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientPacket_Hello* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tz.ClientPacket.Hello";
+  }
+  protected:
+  explicit ClientPacket_Hello(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+  };
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_MUST_USE_RESULT std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:tz.ClientPacket.Hello)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_tz_2eproto;
+};
+// -------------------------------------------------------------------
+
 class ClientPacket_Data final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ClientPacket.Data) */ {
  public:
@@ -151,7 +322,7 @@ class ClientPacket_Data final :
                &_ClientPacket_Data_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    1;
 
   friend void swap(ClientPacket_Data& a, ClientPacket_Data& b) {
     a.Swap(&b);
@@ -227,7 +398,7 @@ class ClientPacket_Data final :
     kXFieldNumber = 3,
     kYFieldNumber = 4,
   };
-  // string uuid = 1;
+  // bytes uuid = 1;
   void clear_uuid();
   const std::string& uuid() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -284,24 +455,24 @@ class ClientPacket_Data final :
 };
 // -------------------------------------------------------------------
 
-class ClientPacket final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ClientPacket) */ {
+class ClientPacket_Batch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ClientPacket.Batch) */ {
  public:
-  inline ClientPacket() : ClientPacket(nullptr) {}
-  ~ClientPacket() override;
-  explicit constexpr ClientPacket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClientPacket_Batch() : ClientPacket_Batch(nullptr) {}
+  ~ClientPacket_Batch() override;
+  explicit constexpr ClientPacket_Batch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ClientPacket(const ClientPacket& from);
-  ClientPacket(ClientPacket&& from) noexcept
-    : ClientPacket() {
+  ClientPacket_Batch(const ClientPacket_Batch& from);
+  ClientPacket_Batch(ClientPacket_Batch&& from) noexcept
+    : ClientPacket_Batch() {
     *this = ::std::move(from);
   }
 
-  inline ClientPacket& operator=(const ClientPacket& from) {
+  inline ClientPacket_Batch& operator=(const ClientPacket_Batch& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ClientPacket& operator=(ClientPacket&& from) noexcept {
+  inline ClientPacket_Batch& operator=(ClientPacket_Batch&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -324,20 +495,20 @@ class ClientPacket final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ClientPacket& default_instance() {
+  static const ClientPacket_Batch& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ClientPacket* internal_default_instance() {
-    return reinterpret_cast<const ClientPacket*>(
-               &_ClientPacket_default_instance_);
+  static inline const ClientPacket_Batch* internal_default_instance() {
+    return reinterpret_cast<const ClientPacket_Batch*>(
+               &_ClientPacket_Batch_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
-  friend void swap(ClientPacket& a, ClientPacket& b) {
+  friend void swap(ClientPacket_Batch& a, ClientPacket_Batch& b) {
     a.Swap(&b);
   }
-  inline void Swap(ClientPacket* other) {
+  inline void Swap(ClientPacket_Batch* other) {
     if (other == this) return;
     if (GetOwningArena() == other->GetOwningArena()) {
       InternalSwap(other);
@@ -345,7 +516,7 @@ class ClientPacket final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ClientPacket* other) {
+  void UnsafeArenaSwap(ClientPacket_Batch* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -353,17 +524,17 @@ class ClientPacket final :
 
   // implements Message ----------------------------------------------
 
-  inline ClientPacket* New() const final {
-    return new ClientPacket();
+  inline ClientPacket_Batch* New() const final {
+    return new ClientPacket_Batch();
   }
 
-  ClientPacket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ClientPacket>(arena);
+  ClientPacket_Batch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ClientPacket_Batch>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ClientPacket& from);
+  void CopyFrom(const ClientPacket_Batch& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const ClientPacket& from);
+  void MergeFrom(const ClientPacket_Batch& from);
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
   public:
@@ -380,13 +551,13 @@ class ClientPacket final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ClientPacket* other);
+  void InternalSwap(ClientPacket_Batch* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "tz.ClientPacket";
+    return "tz.ClientPacket.Batch";
   }
   protected:
-  explicit ClientPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClientPacket_Batch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -400,104 +571,60 @@ class ClientPacket final :
 
   // nested types ----------------------------------------------------
 
-  typedef ClientPacket_Data Data;
-
-  typedef ClientPacket_PacketType PacketType;
-  static constexpr PacketType DATA =
-    ClientPacket_PacketType_DATA;
-  static constexpr PacketType STATISTICS =
-    ClientPacket_PacketType_STATISTICS;
-  static inline bool PacketType_IsValid(int value) {
-    return ClientPacket_PacketType_IsValid(value);
-  }
-  static constexpr PacketType PacketType_MIN =
-    ClientPacket_PacketType_PacketType_MIN;
-  static constexpr PacketType PacketType_MAX =
-    ClientPacket_PacketType_PacketType_MAX;
-  static constexpr int PacketType_ARRAYSIZE =
-    ClientPacket_PacketType_PacketType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  PacketType_descriptor() {
-    return ClientPacket_PacketType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& PacketType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, PacketType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function PacketType_Name.");
-    return ClientPacket_PacketType_Name(enum_t_value);
-  }
-  static inline bool PacketType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      PacketType* value) {
-    return ClientPacket_PacketType_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDataFieldNumber = 2,
-    kTypeFieldNumber = 1,
+    kPointFieldNumber = 1,
   };
-  // optional .tz.ClientPacket.Data data = 2;
-  bool has_data() const;
-  private:
-  bool _internal_has_data() const;
-  public:
-  void clear_data();
-  const ::tz::ClientPacket_Data& data() const;
-  PROTOBUF_MUST_USE_RESULT ::tz::ClientPacket_Data* release_data();
-  ::tz::ClientPacket_Data* mutable_data();
-  void set_allocated_data(::tz::ClientPacket_Data* data);
+  // repeated .tz.ClientPacket.Data point = 1;
+  int point_size() const;
   private:
-  const ::tz::ClientPacket_Data& _internal_data() const;
-  ::tz::ClientPacket_Data* _internal_mutable_data();
+  int _internal_point_size() const;
   public:
-  void unsafe_arena_set_allocated_data(
-      ::tz::ClientPacket_Data* data);
-  ::tz::ClientPacket_Data* unsafe_arena_release_data();
-
-  // .tz.ClientPacket.PacketType type = 1;
-  void clear_type();
-  ::tz::ClientPacket_PacketType type() const;
-  void set_type(::tz::ClientPacket_PacketType value);
+  void clear_point();
+  ::tz::ClientPacket_Data* mutable_point(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ClientPacket_Data >*
+      mutable_point();
   private:
-  ::tz::ClientPacket_PacketType _internal_type() const;
-  void _internal_set_type(::tz::ClientPacket_PacketType value);
+  const ::tz::ClientPacket_Data& _internal_point(int index) const;
+  ::tz::ClientPacket_Data* _internal_add_point();
   public:
+  const ::tz::ClientPacket_Data& point(int index) const;
+  ::tz::ClientPacket_Data* add_point();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ClientPacket_Data >&
+      point() const;
 
-  // @@protoc_insertion_point(class_scope:tz.ClientPacket)
+  // @@protoc_insertion_point(class_scope:tz.ClientPacket.Batch)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ClientPacket_Data > point_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  ::tz::ClientPacket_Data* data_;
-  int type_;
   friend struct ::TableStruct_tz_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ServerStatistic_Statistic final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ServerStatistic.Statistic) */ {
+class ClientPacket_Columns final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ClientPacket.Columns) */ {
  public:
-  inline ServerStatistic_Statistic() : ServerStatistic_Statistic(nullptr) {}
-  ~ServerStatistic_Statistic() override;
-  explicit constexpr ServerStatistic_Statistic(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ClientPacket_Columns() : ClientPacket_Columns(nullptr) {}
+  ~ClientPacket_Columns() override;
+  explicit constexpr ClientPacket_Columns(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ServerStatistic_Statistic(const ServerStatistic_Statistic& from);
-  ServerStatistic_Statistic(ServerStatistic_Statistic&& from) noexcept
-    : ServerStatistic_Statistic() {
+  ClientPacket_Columns(const ClientPacket_Columns& from);
+  ClientPacket_Columns(ClientPacket_Columns&& from) noexcept
+    : ClientPacket_Columns() {
     *this = ::std::move(from);
   }
 
-  inline ServerStatistic_Statistic& operator=(const ServerStatistic_Statistic& from) {
+  inline ClientPacket_Columns& operator=(const ClientPacket_Columns& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ServerStatistic_Statistic& operator=(ServerStatistic_Statistic&& from) noexcept {
+  inline ClientPacket_Columns& operator=(ClientPacket_Columns&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -520,20 +647,20 @@ class ServerStatistic_Statistic final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ServerStatistic_Statistic& default_instance() {
+  static const ClientPacket_Columns& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ServerStatistic_Statistic* internal_default_instance() {
-    return reinterpret_cast<const ServerStatistic_Statistic*>(
-               &_ServerStatistic_Statistic_default_instance_);
+  static inline const ClientPacket_Columns* internal_default_instance() {
+    return reinterpret_cast<const ClientPacket_Columns*>(
+               &_ClientPacket_Columns_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
-  friend void swap(ServerStatistic_Statistic& a, ServerStatistic_Statistic& b) {
+  friend void swap(ClientPacket_Columns& a, ClientPacket_Columns& b) {
     a.Swap(&b);
   }
-  inline void Swap(ServerStatistic_Statistic* other) {
+  inline void Swap(ClientPacket_Columns* other) {
     if (other == this) return;
     if (GetOwningArena() == other->GetOwningArena()) {
       InternalSwap(other);
@@ -541,7 +668,7 @@ class ServerStatistic_Statistic final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ServerStatistic_Statistic* other) {
+  void UnsafeArenaSwap(ClientPacket_Columns* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -549,17 +676,17 @@ class ServerStatistic_Statistic final :
 
   // implements Message ----------------------------------------------
 
-  inline ServerStatistic_Statistic* New() const final {
-    return new ServerStatistic_Statistic();
+  inline ClientPacket_Columns* New() const final {
+    return new ClientPacket_Columns();
   }
 
-  ServerStatistic_Statistic* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<ServerStatistic_Statistic>(arena);
+  ClientPacket_Columns* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ClientPacket_Columns>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ServerStatistic_Statistic& from);
+  void CopyFrom(const ClientPacket_Columns& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const ServerStatistic_Statistic& from);
+  void MergeFrom(const ClientPacket_Columns& from);
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
   public:
@@ -576,13 +703,13 @@ class ServerStatistic_Statistic final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ServerStatistic_Statistic* other);
+  void InternalSwap(ClientPacket_Columns* other);
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "tz.ServerStatistic.Statistic";
+    return "tz.ClientPacket.Columns";
   }
   protected:
-  explicit ServerStatistic_Statistic(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ClientPacket_Columns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -599,26 +726,874 @@ class ServerStatistic_Statistic final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kTimestampFieldNumber = 2,
+    kXFieldNumber = 3,
+    kYFieldNumber = 4,
     kUuidFieldNumber = 1,
-    kX1FieldNumber = 2,
-    kY1FieldNumber = 3,
-    kX5FieldNumber = 4,
-    kY5FieldNumber = 5,
   };
-  // string uuid = 1;
-  void clear_uuid();
-  const std::string& uuid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_uuid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_uuid();
-  PROTOBUF_MUST_USE_RESULT std::string* release_uuid();
-  void set_allocated_uuid(std::string* uuid);
+  // repeated sint64 timestamp = 2;
+  int timestamp_size() const;
   private:
-  const std::string& _internal_uuid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
-  std::string* _internal_mutable_uuid();
+  int _internal_timestamp_size() const;
   public:
-
+  void clear_timestamp();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int64 _internal_timestamp(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      _internal_timestamp() const;
+  void _internal_add_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      _internal_mutable_timestamp();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::int64 timestamp(int index) const;
+  void set_timestamp(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      timestamp() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_timestamp();
+
+  // repeated double x = 3;
+  int x_size() const;
+  private:
+  int _internal_x_size() const;
+  public:
+  void clear_x();
+  private:
+  double _internal_x(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_x() const;
+  void _internal_add_x(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_x();
+  public:
+  double x(int index) const;
+  void set_x(int index, double value);
+  void add_x(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      x() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_x();
+
+  // repeated double y = 4;
+  int y_size() const;
+  private:
+  int _internal_y_size() const;
+  public:
+  void clear_y();
+  private:
+  double _internal_y(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_y() const;
+  void _internal_add_y(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_y();
+  public:
+  double y(int index) const;
+  void set_y(int index, double value);
+  void add_y(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      y() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_y();
+
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_MUST_USE_RESULT std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:tz.ClientPacket.Columns)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > timestamp_;
+  mutable std::atomic<int> _timestamp_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > x_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > y_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_tz_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClientPacket_StatisticsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ClientPacket.StatisticsRequest) */ {
+ public:
+  inline ClientPacket_StatisticsRequest() : ClientPacket_StatisticsRequest(nullptr) {}
+  ~ClientPacket_StatisticsRequest() override;
+  explicit constexpr ClientPacket_StatisticsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientPacket_StatisticsRequest(const ClientPacket_StatisticsRequest& from);
+  ClientPacket_StatisticsRequest(ClientPacket_StatisticsRequest&& from) noexcept
+    : ClientPacket_StatisticsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientPacket_StatisticsRequest& operator=(const ClientPacket_StatisticsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientPacket_StatisticsRequest& operator=(ClientPacket_StatisticsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientPacket_StatisticsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientPacket_StatisticsRequest* internal_default_instance() {
+    return reinterpret_cast<const ClientPacket_StatisticsRequest*>(
+               &_ClientPacket_StatisticsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ClientPacket_StatisticsRequest& a, ClientPacket_StatisticsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientPacket_StatisticsRequest* other) {
+    if (other == this) return;
+    if (GetOwningArena() == other->GetOwningArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientPacket_StatisticsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ClientPacket_StatisticsRequest* New() const final {
+    return new ClientPacket_StatisticsRequest();
+  }
+
+  ClientPacket_StatisticsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ClientPacket_StatisticsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientPacket_StatisticsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom(const ClientPacket_StatisticsRequest& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientPacket_StatisticsRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tz.ClientPacket.StatisticsRequest";
+  }
+  protected:
+  explicit ClientPacket_StatisticsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWindowSecondsFieldNumber = 1,
+  };
+  // repeated uint32 window_seconds = 1;
+  int window_seconds_size() const;
+  private:
+  int _internal_window_seconds_size() const;
+  public:
+  void clear_window_seconds();
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_window_seconds(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      _internal_window_seconds() const;
+  void _internal_add_window_seconds(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      _internal_mutable_window_seconds();
+  public:
+  ::PROTOBUF_NAMESPACE_ID::uint32 window_seconds(int index) const;
+  void set_window_seconds(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value);
+  void add_window_seconds(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+      window_seconds() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+      mutable_window_seconds();
+
+  // @@protoc_insertion_point(class_scope:tz.ClientPacket.StatisticsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 > window_seconds_;
+  mutable std::atomic<int> _window_seconds_cached_byte_size_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_tz_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClientPacket final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ClientPacket) */ {
+ public:
+  inline ClientPacket() : ClientPacket(nullptr) {}
+  ~ClientPacket() override;
+  explicit constexpr ClientPacket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClientPacket(const ClientPacket& from);
+  ClientPacket(ClientPacket&& from) noexcept
+    : ClientPacket() {
+    *this = ::std::move(from);
+  }
+
+  inline ClientPacket& operator=(const ClientPacket& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClientPacket& operator=(ClientPacket&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClientPacket& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClientPacket* internal_default_instance() {
+    return reinterpret_cast<const ClientPacket*>(
+               &_ClientPacket_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ClientPacket& a, ClientPacket& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClientPacket* other) {
+    if (other == this) return;
+    if (GetOwningArena() == other->GetOwningArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClientPacket* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ClientPacket* New() const final {
+    return new ClientPacket();
+  }
+
+  ClientPacket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ClientPacket>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClientPacket& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom(const ClientPacket& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClientPacket* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tz.ClientPacket";
+  }
+  protected:
+  explicit ClientPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef ClientPacket_Hello Hello;
+  typedef ClientPacket_Data Data;
+  typedef ClientPacket_Batch Batch;
+  typedef ClientPacket_Columns Columns;
+  typedef ClientPacket_StatisticsRequest StatisticsRequest;
+
+  typedef ClientPacket_PacketType PacketType;
+  static constexpr PacketType DATA =
+    ClientPacket_PacketType_DATA;
+  static constexpr PacketType STATISTICS =
+    ClientPacket_PacketType_STATISTICS;
+  static constexpr PacketType BATCH =
+    ClientPacket_PacketType_BATCH;
+  static constexpr PacketType COLUMNS =
+    ClientPacket_PacketType_COLUMNS;
+  static constexpr PacketType HELLO =
+    ClientPacket_PacketType_HELLO;
+  static inline bool PacketType_IsValid(int value) {
+    return ClientPacket_PacketType_IsValid(value);
+  }
+  static constexpr PacketType PacketType_MIN =
+    ClientPacket_PacketType_PacketType_MIN;
+  static constexpr PacketType PacketType_MAX =
+    ClientPacket_PacketType_PacketType_MAX;
+  static constexpr int PacketType_ARRAYSIZE =
+    ClientPacket_PacketType_PacketType_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  PacketType_descriptor() {
+    return ClientPacket_PacketType_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& PacketType_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, PacketType>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function PacketType_Name.");
+    return ClientPacket_PacketType_Name(enum_t_value);
+  }
+  static inline bool PacketType_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      PacketType* value) {
+    return ClientPacket_PacketType_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 2,
+    kBatchFieldNumber = 3,
+    kColumnsFieldNumber = 4,
+    kHelloFieldNumber = 5,
+    kStatisticsFieldNumber = 6,
+    kTypeFieldNumber = 1,
+  };
+  // optional .tz.ClientPacket.Data data = 2;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const ::tz::ClientPacket_Data& data() const;
+  PROTOBUF_MUST_USE_RESULT ::tz::ClientPacket_Data* release_data();
+  ::tz::ClientPacket_Data* mutable_data();
+  void set_allocated_data(::tz::ClientPacket_Data* data);
+  private:
+  const ::tz::ClientPacket_Data& _internal_data() const;
+  ::tz::ClientPacket_Data* _internal_mutable_data();
+  public:
+  void unsafe_arena_set_allocated_data(
+      ::tz::ClientPacket_Data* data);
+  ::tz::ClientPacket_Data* unsafe_arena_release_data();
+
+  // optional .tz.ClientPacket.Batch batch = 3;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  const ::tz::ClientPacket_Batch& batch() const;
+  PROTOBUF_MUST_USE_RESULT ::tz::ClientPacket_Batch* release_batch();
+  ::tz::ClientPacket_Batch* mutable_batch();
+  void set_allocated_batch(::tz::ClientPacket_Batch* batch);
+  private:
+  const ::tz::ClientPacket_Batch& _internal_batch() const;
+  ::tz::ClientPacket_Batch* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::tz::ClientPacket_Batch* batch);
+  ::tz::ClientPacket_Batch* unsafe_arena_release_batch();
+
+  // optional .tz.ClientPacket.Columns columns = 4;
+  bool has_columns() const;
+  private:
+  bool _internal_has_columns() const;
+  public:
+  void clear_columns();
+  const ::tz::ClientPacket_Columns& columns() const;
+  PROTOBUF_MUST_USE_RESULT ::tz::ClientPacket_Columns* release_columns();
+  ::tz::ClientPacket_Columns* mutable_columns();
+  void set_allocated_columns(::tz::ClientPacket_Columns* columns);
+  private:
+  const ::tz::ClientPacket_Columns& _internal_columns() const;
+  ::tz::ClientPacket_Columns* _internal_mutable_columns();
+  public:
+  void unsafe_arena_set_allocated_columns(
+      ::tz::ClientPacket_Columns* columns);
+  ::tz::ClientPacket_Columns* unsafe_arena_release_columns();
+
+  // optional .tz.ClientPacket.Hello hello = 5;
+  bool has_hello() const;
+  private:
+  bool _internal_has_hello() const;
+  public:
+  void clear_hello();
+  const ::tz::ClientPacket_Hello& hello() const;
+  PROTOBUF_MUST_USE_RESULT ::tz::ClientPacket_Hello* release_hello();
+  ::tz::ClientPacket_Hello* mutable_hello();
+  void set_allocated_hello(::tz::ClientPacket_Hello* hello);
+  private:
+  const ::tz::ClientPacket_Hello& _internal_hello() const;
+  ::tz::ClientPacket_Hello* _internal_mutable_hello();
+  public:
+  void unsafe_arena_set_allocated_hello(
+      ::tz::ClientPacket_Hello* hello);
+  ::tz::ClientPacket_Hello* unsafe_arena_release_hello();
+
+  // optional .tz.ClientPacket.StatisticsRequest statistics = 6;
+  bool has_statistics() const;
+  private:
+  bool _internal_has_statistics() const;
+  public:
+  void clear_statistics();
+  const ::tz::ClientPacket_StatisticsRequest& statistics() const;
+  PROTOBUF_MUST_USE_RESULT ::tz::ClientPacket_StatisticsRequest* release_statistics();
+  ::tz::ClientPacket_StatisticsRequest* mutable_statistics();
+  void set_allocated_statistics(::tz::ClientPacket_StatisticsRequest* statistics);
+  private:
+  const ::tz::ClientPacket_StatisticsRequest& _internal_statistics() const;
+  ::tz::ClientPacket_StatisticsRequest* _internal_mutable_statistics();
+  public:
+  void unsafe_arena_set_allocated_statistics(
+      ::tz::ClientPacket_StatisticsRequest* statistics);
+  ::tz::ClientPacket_StatisticsRequest* unsafe_arena_release_statistics();
+
+  // .tz.ClientPacket.PacketType type = 1;
+  void clear_type();
+  ::tz::ClientPacket_PacketType type() const;
+  void set_type(::tz::ClientPacket_PacketType value);
+  private:
+  ::tz::ClientPacket_PacketType _internal_type() const;
+  void _internal_set_type(::tz::ClientPacket_PacketType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tz.ClientPacket)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::tz::ClientPacket_Data* data_;
+  ::tz::ClientPacket_Batch* batch_;
+  ::tz::ClientPacket_Columns* columns_;
+  ::tz::ClientPacket_Hello* hello_;
+  ::tz::ClientPacket_StatisticsRequest* statistics_;
+  int type_;
+  friend struct ::TableStruct_tz_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStatistic_WindowStat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ServerStatistic.WindowStat) */ {
+ public:
+  inline ServerStatistic_WindowStat() : ServerStatistic_WindowStat(nullptr) {}
+  ~ServerStatistic_WindowStat() override;
+  explicit constexpr ServerStatistic_WindowStat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatistic_WindowStat(const ServerStatistic_WindowStat& from);
+  ServerStatistic_WindowStat(ServerStatistic_WindowStat&& from) noexcept
+    : ServerStatistic_WindowStat() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatistic_WindowStat& operator=(const ServerStatistic_WindowStat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatistic_WindowStat& operator=(ServerStatistic_WindowStat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatistic_WindowStat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatistic_WindowStat* internal_default_instance() {
+    return reinterpret_cast<const ServerStatistic_WindowStat*>(
+               &_ServerStatistic_WindowStat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ServerStatistic_WindowStat& a, ServerStatistic_WindowStat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatistic_WindowStat* other) {
+    if (other == this) return;
+    if (GetOwningArena() == other->GetOwningArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatistic_WindowStat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ServerStatistic_WindowStat* New() const final {
+    return new ServerStatistic_WindowStat();
+  }
+
+  ServerStatistic_WindowStat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ServerStatistic_WindowStat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatistic_WindowStat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom(const ServerStatistic_WindowStat& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatistic_WindowStat* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tz.ServerStatistic.WindowStat";
+  }
+  protected:
+  explicit ServerStatistic_WindowStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kXFieldNumber = 2,
+    kYFieldNumber = 3,
+    kSecondsFieldNumber = 1,
+  };
+  // double x = 2;
+  void clear_x();
+  double x() const;
+  void set_x(double value);
+  private:
+  double _internal_x() const;
+  void _internal_set_x(double value);
+  public:
+
+  // double y = 3;
+  void clear_y();
+  double y() const;
+  void set_y(double value);
+  private:
+  double _internal_y() const;
+  void _internal_set_y(double value);
+  public:
+
+  // uint32 seconds = 1;
+  void clear_seconds();
+  ::PROTOBUF_NAMESPACE_ID::uint32 seconds() const;
+  void set_seconds(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_seconds() const;
+  void _internal_set_seconds(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:tz.ServerStatistic.WindowStat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  double x_;
+  double y_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 seconds_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_tz_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStatistic_Statistic final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:tz.ServerStatistic.Statistic) */ {
+ public:
+  inline ServerStatistic_Statistic() : ServerStatistic_Statistic(nullptr) {}
+  ~ServerStatistic_Statistic() override;
+  explicit constexpr ServerStatistic_Statistic(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStatistic_Statistic(const ServerStatistic_Statistic& from);
+  ServerStatistic_Statistic(ServerStatistic_Statistic&& from) noexcept
+    : ServerStatistic_Statistic() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStatistic_Statistic& operator=(const ServerStatistic_Statistic& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStatistic_Statistic& operator=(ServerStatistic_Statistic&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStatistic_Statistic& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStatistic_Statistic* internal_default_instance() {
+    return reinterpret_cast<const ServerStatistic_Statistic*>(
+               &_ServerStatistic_Statistic_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(ServerStatistic_Statistic& a, ServerStatistic_Statistic& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStatistic_Statistic* other) {
+    if (other == this) return;
+    if (GetOwningArena() == other->GetOwningArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStatistic_Statistic* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline ServerStatistic_Statistic* New() const final {
+    return new ServerStatistic_Statistic();
+  }
+
+  ServerStatistic_Statistic* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<ServerStatistic_Statistic>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStatistic_Statistic& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom(const ServerStatistic_Statistic& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStatistic_Statistic* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "tz.ServerStatistic.Statistic";
+  }
+  protected:
+  explicit ServerStatistic_Statistic(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWindowFieldNumber = 6,
+    kUuidFieldNumber = 1,
+    kX1FieldNumber = 2,
+    kY1FieldNumber = 3,
+    kX5FieldNumber = 4,
+    kY5FieldNumber = 5,
+  };
+  // repeated .tz.ServerStatistic.WindowStat window = 6;
+  int window_size() const;
+  private:
+  int _internal_window_size() const;
+  public:
+  void clear_window();
+  ::tz::ServerStatistic_WindowStat* mutable_window(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ServerStatistic_WindowStat >*
+      mutable_window();
+  private:
+  const ::tz::ServerStatistic_WindowStat& _internal_window(int index) const;
+  ::tz::ServerStatistic_WindowStat* _internal_add_window();
+  public:
+  const ::tz::ServerStatistic_WindowStat& window(int index) const;
+  ::tz::ServerStatistic_WindowStat* add_window();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ServerStatistic_WindowStat >&
+      window() const;
+
+  // bytes uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_MUST_USE_RESULT std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
   // double x1 = 2;
   void clear_x1();
   double x1() const;
@@ -662,6 +1637,7 @@ class ServerStatistic_Statistic final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ServerStatistic_WindowStat > window_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
   double x1_;
   double y1_;
@@ -720,7 +1696,7 @@ class ServerStatistic final :
                &_ServerStatistic_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    8;
 
   friend void swap(ServerStatistic& a, ServerStatistic& b) {
     a.Swap(&b);
@@ -788,12 +1764,14 @@ class ServerStatistic final :
 
   // nested types ----------------------------------------------------
 
+  typedef ServerStatistic_WindowStat WindowStat;
   typedef ServerStatistic_Statistic Statistic;
 
   // accessors -------------------------------------------------------
 
   enum : int {
     kClientFieldNumber = 1,
+    kVersionFieldNumber = 2,
   };
   // repeated .tz.ServerStatistic.Statistic client = 1;
   int client_size() const;
@@ -813,6 +1791,15 @@ class ServerStatistic final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ServerStatistic_Statistic >&
       client() const;
 
+  // uint64 version = 2;
+  void clear_version();
+  ::PROTOBUF_NAMESPACE_ID::uint64 version() const;
+  void set_version(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_version() const;
+  void _internal_set_version(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
   // @@protoc_insertion_point(class_scope:tz.ServerStatistic)
  private:
   class _Internal;
@@ -821,6 +1808,7 @@ class ServerStatistic final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ServerStatistic_Statistic > client_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 version_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_tz_2eproto;
 };
@@ -833,9 +1821,59 @@ class ServerStatistic final :
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
+// ClientPacket_Hello
+
+// bytes uuid = 1;
+inline void ClientPacket_Hello::clear_uuid() {
+  uuid_.ClearToEmpty();
+}
+inline const std::string& ClientPacket_Hello::uuid() const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.Hello.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClientPacket_Hello::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ uuid_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.Hello.uuid)
+}
+inline std::string* ClientPacket_Hello::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:tz.ClientPacket.Hello.uuid)
+  return _s;
+}
+inline const std::string& ClientPacket_Hello::_internal_uuid() const {
+  return uuid_.Get();
+}
+inline void ClientPacket_Hello::_internal_set_uuid(const std::string& value) {
+  
+  uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+}
+inline std::string* ClientPacket_Hello::_internal_mutable_uuid() {
+  
+  return uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+}
+inline std::string* ClientPacket_Hello::release_uuid() {
+  // @@protoc_insertion_point(field_release:tz.ClientPacket.Hello.uuid)
+  return uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+}
+inline void ClientPacket_Hello::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), uuid,
+      GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:tz.ClientPacket.Hello.uuid)
+}
+
+// -------------------------------------------------------------------
+
 // ClientPacket_Data
 
-// string uuid = 1;
+// bytes uuid = 1;
 inline void ClientPacket_Data::clear_uuid() {
   uuid_.ClearToEmpty();
 }
@@ -847,7 +1885,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ClientPacket_Data::set_uuid(ArgT0&& arg0, ArgT... args) {
  
- uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ uuid_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:tz.ClientPacket.Data.uuid)
 }
 inline std::string* ClientPacket_Data::mutable_uuid() {
@@ -892,53 +1930,339 @@ inline ::PROTOBUF_NAMESPACE_ID::int64 ClientPacket_Data::timestamp() const {
   // @@protoc_insertion_point(field_get:tz.ClientPacket.Data.timestamp)
   return _internal_timestamp();
 }
-inline void ClientPacket_Data::_internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  
-  timestamp_ = value;
+inline void ClientPacket_Data::_internal_set_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  timestamp_ = value;
+}
+inline void ClientPacket_Data::set_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.Data.timestamp)
+}
+
+// double x = 3;
+inline void ClientPacket_Data::clear_x() {
+  x_ = 0;
+}
+inline double ClientPacket_Data::_internal_x() const {
+  return x_;
+}
+inline double ClientPacket_Data::x() const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.Data.x)
+  return _internal_x();
+}
+inline void ClientPacket_Data::_internal_set_x(double value) {
+  
+  x_ = value;
+}
+inline void ClientPacket_Data::set_x(double value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.Data.x)
+}
+
+// double y = 4;
+inline void ClientPacket_Data::clear_y() {
+  y_ = 0;
+}
+inline double ClientPacket_Data::_internal_y() const {
+  return y_;
+}
+inline double ClientPacket_Data::y() const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.Data.y)
+  return _internal_y();
+}
+inline void ClientPacket_Data::_internal_set_y(double value) {
+  
+  y_ = value;
+}
+inline void ClientPacket_Data::set_y(double value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.Data.y)
+}
+
+// -------------------------------------------------------------------
+
+// ClientPacket_Batch
+
+// repeated .tz.ClientPacket.Data point = 1;
+inline int ClientPacket_Batch::_internal_point_size() const {
+  return point_.size();
+}
+inline int ClientPacket_Batch::point_size() const {
+  return _internal_point_size();
+}
+inline void ClientPacket_Batch::clear_point() {
+  point_.Clear();
+}
+inline ::tz::ClientPacket_Data* ClientPacket_Batch::mutable_point(int index) {
+  // @@protoc_insertion_point(field_mutable:tz.ClientPacket.Batch.point)
+  return point_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ClientPacket_Data >*
+ClientPacket_Batch::mutable_point() {
+  // @@protoc_insertion_point(field_mutable_list:tz.ClientPacket.Batch.point)
+  return &point_;
+}
+inline const ::tz::ClientPacket_Data& ClientPacket_Batch::_internal_point(int index) const {
+  return point_.Get(index);
+}
+inline const ::tz::ClientPacket_Data& ClientPacket_Batch::point(int index) const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.Batch.point)
+  return _internal_point(index);
+}
+inline ::tz::ClientPacket_Data* ClientPacket_Batch::_internal_add_point() {
+  return point_.Add();
+}
+inline ::tz::ClientPacket_Data* ClientPacket_Batch::add_point() {
+  ::tz::ClientPacket_Data* _add = _internal_add_point();
+  // @@protoc_insertion_point(field_add:tz.ClientPacket.Batch.point)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ClientPacket_Data >&
+ClientPacket_Batch::point() const {
+  // @@protoc_insertion_point(field_list:tz.ClientPacket.Batch.point)
+  return point_;
+}
+
+// -------------------------------------------------------------------
+
+// ClientPacket_Columns
+
+// bytes uuid = 1;
+inline void ClientPacket_Columns::clear_uuid() {
+  uuid_.ClearToEmpty();
+}
+inline const std::string& ClientPacket_Columns::uuid() const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.Columns.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClientPacket_Columns::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ uuid_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.Columns.uuid)
+}
+inline std::string* ClientPacket_Columns::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:tz.ClientPacket.Columns.uuid)
+  return _s;
+}
+inline const std::string& ClientPacket_Columns::_internal_uuid() const {
+  return uuid_.Get();
+}
+inline void ClientPacket_Columns::_internal_set_uuid(const std::string& value) {
+  
+  uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArenaForAllocation());
+}
+inline std::string* ClientPacket_Columns::_internal_mutable_uuid() {
+  
+  return uuid_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArenaForAllocation());
+}
+inline std::string* ClientPacket_Columns::release_uuid() {
+  // @@protoc_insertion_point(field_release:tz.ClientPacket.Columns.uuid)
+  return uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArenaForAllocation());
+}
+inline void ClientPacket_Columns::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), uuid,
+      GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:tz.ClientPacket.Columns.uuid)
+}
+
+// repeated sint64 timestamp = 2;
+inline int ClientPacket_Columns::_internal_timestamp_size() const {
+  return timestamp_.size();
+}
+inline int ClientPacket_Columns::timestamp_size() const {
+  return _internal_timestamp_size();
+}
+inline void ClientPacket_Columns::clear_timestamp() {
+  timestamp_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 ClientPacket_Columns::_internal_timestamp(int index) const {
+  return timestamp_.Get(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 ClientPacket_Columns::timestamp(int index) const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.Columns.timestamp)
+  return _internal_timestamp(index);
+}
+inline void ClientPacket_Columns::set_timestamp(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  timestamp_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.Columns.timestamp)
+}
+inline void ClientPacket_Columns::_internal_add_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  timestamp_.Add(value);
+}
+inline void ClientPacket_Columns::add_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  _internal_add_timestamp(value);
+  // @@protoc_insertion_point(field_add:tz.ClientPacket.Columns.timestamp)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+ClientPacket_Columns::_internal_timestamp() const {
+  return timestamp_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+ClientPacket_Columns::timestamp() const {
+  // @@protoc_insertion_point(field_list:tz.ClientPacket.Columns.timestamp)
+  return _internal_timestamp();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+ClientPacket_Columns::_internal_mutable_timestamp() {
+  return &timestamp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+ClientPacket_Columns::mutable_timestamp() {
+  // @@protoc_insertion_point(field_mutable_list:tz.ClientPacket.Columns.timestamp)
+  return _internal_mutable_timestamp();
+}
+
+// repeated double x = 3;
+inline int ClientPacket_Columns::_internal_x_size() const {
+  return x_.size();
+}
+inline int ClientPacket_Columns::x_size() const {
+  return _internal_x_size();
+}
+inline void ClientPacket_Columns::clear_x() {
+  x_.Clear();
+}
+inline double ClientPacket_Columns::_internal_x(int index) const {
+  return x_.Get(index);
+}
+inline double ClientPacket_Columns::x(int index) const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.Columns.x)
+  return _internal_x(index);
+}
+inline void ClientPacket_Columns::set_x(int index, double value) {
+  x_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.Columns.x)
+}
+inline void ClientPacket_Columns::_internal_add_x(double value) {
+  x_.Add(value);
+}
+inline void ClientPacket_Columns::add_x(double value) {
+  _internal_add_x(value);
+  // @@protoc_insertion_point(field_add:tz.ClientPacket.Columns.x)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+ClientPacket_Columns::_internal_x() const {
+  return x_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+ClientPacket_Columns::x() const {
+  // @@protoc_insertion_point(field_list:tz.ClientPacket.Columns.x)
+  return _internal_x();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+ClientPacket_Columns::_internal_mutable_x() {
+  return &x_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+ClientPacket_Columns::mutable_x() {
+  // @@protoc_insertion_point(field_mutable_list:tz.ClientPacket.Columns.x)
+  return _internal_mutable_x();
+}
+
+// repeated double y = 4;
+inline int ClientPacket_Columns::_internal_y_size() const {
+  return y_.size();
+}
+inline int ClientPacket_Columns::y_size() const {
+  return _internal_y_size();
+}
+inline void ClientPacket_Columns::clear_y() {
+  y_.Clear();
+}
+inline double ClientPacket_Columns::_internal_y(int index) const {
+  return y_.Get(index);
+}
+inline double ClientPacket_Columns::y(int index) const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.Columns.y)
+  return _internal_y(index);
+}
+inline void ClientPacket_Columns::set_y(int index, double value) {
+  y_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.Columns.y)
+}
+inline void ClientPacket_Columns::_internal_add_y(double value) {
+  y_.Add(value);
+}
+inline void ClientPacket_Columns::add_y(double value) {
+  _internal_add_y(value);
+  // @@protoc_insertion_point(field_add:tz.ClientPacket.Columns.y)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+ClientPacket_Columns::_internal_y() const {
+  return y_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+ClientPacket_Columns::y() const {
+  // @@protoc_insertion_point(field_list:tz.ClientPacket.Columns.y)
+  return _internal_y();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+ClientPacket_Columns::_internal_mutable_y() {
+  return &y_;
 }
-inline void ClientPacket_Data::set_timestamp(::PROTOBUF_NAMESPACE_ID::int64 value) {
-  _internal_set_timestamp(value);
-  // @@protoc_insertion_point(field_set:tz.ClientPacket.Data.timestamp)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+ClientPacket_Columns::mutable_y() {
+  // @@protoc_insertion_point(field_mutable_list:tz.ClientPacket.Columns.y)
+  return _internal_mutable_y();
 }
 
-// double x = 3;
-inline void ClientPacket_Data::clear_x() {
-  x_ = 0;
+// -------------------------------------------------------------------
+
+// ClientPacket_StatisticsRequest
+
+// repeated uint32 window_seconds = 1;
+inline int ClientPacket_StatisticsRequest::_internal_window_seconds_size() const {
+  return window_seconds_.size();
 }
-inline double ClientPacket_Data::_internal_x() const {
-  return x_;
+inline int ClientPacket_StatisticsRequest::window_seconds_size() const {
+  return _internal_window_seconds_size();
 }
-inline double ClientPacket_Data::x() const {
-  // @@protoc_insertion_point(field_get:tz.ClientPacket.Data.x)
-  return _internal_x();
+inline void ClientPacket_StatisticsRequest::clear_window_seconds() {
+  window_seconds_.Clear();
 }
-inline void ClientPacket_Data::_internal_set_x(double value) {
-  
-  x_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::uint32 ClientPacket_StatisticsRequest::_internal_window_seconds(int index) const {
+  return window_seconds_.Get(index);
 }
-inline void ClientPacket_Data::set_x(double value) {
-  _internal_set_x(value);
-  // @@protoc_insertion_point(field_set:tz.ClientPacket.Data.x)
+inline ::PROTOBUF_NAMESPACE_ID::uint32 ClientPacket_StatisticsRequest::window_seconds(int index) const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.StatisticsRequest.window_seconds)
+  return _internal_window_seconds(index);
 }
-
-// double y = 4;
-inline void ClientPacket_Data::clear_y() {
-  y_ = 0;
+inline void ClientPacket_StatisticsRequest::set_window_seconds(int index, ::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  window_seconds_.Set(index, value);
+  // @@protoc_insertion_point(field_set:tz.ClientPacket.StatisticsRequest.window_seconds)
 }
-inline double ClientPacket_Data::_internal_y() const {
-  return y_;
+inline void ClientPacket_StatisticsRequest::_internal_add_window_seconds(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  window_seconds_.Add(value);
 }
-inline double ClientPacket_Data::y() const {
-  // @@protoc_insertion_point(field_get:tz.ClientPacket.Data.y)
-  return _internal_y();
+inline void ClientPacket_StatisticsRequest::add_window_seconds(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_add_window_seconds(value);
+  // @@protoc_insertion_point(field_add:tz.ClientPacket.StatisticsRequest.window_seconds)
 }
-inline void ClientPacket_Data::_internal_set_y(double value) {
-  
-  y_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+ClientPacket_StatisticsRequest::_internal_window_seconds() const {
+  return window_seconds_;
 }
-inline void ClientPacket_Data::set_y(double value) {
-  _internal_set_y(value);
-  // @@protoc_insertion_point(field_set:tz.ClientPacket.Data.y)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >&
+ClientPacket_StatisticsRequest::window_seconds() const {
+  // @@protoc_insertion_point(field_list:tz.ClientPacket.StatisticsRequest.window_seconds)
+  return _internal_window_seconds();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+ClientPacket_StatisticsRequest::_internal_mutable_window_seconds() {
+  return &window_seconds_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint32 >*
+ClientPacket_StatisticsRequest::mutable_window_seconds() {
+  // @@protoc_insertion_point(field_mutable_list:tz.ClientPacket.StatisticsRequest.window_seconds)
+  return _internal_mutable_window_seconds();
 }
 
 // -------------------------------------------------------------------
@@ -1055,11 +2379,435 @@ inline void ClientPacket::set_allocated_data(::tz::ClientPacket_Data* data) {
   // @@protoc_insertion_point(field_set_allocated:tz.ClientPacket.data)
 }
 
+// optional .tz.ClientPacket.Batch batch = 3;
+inline bool ClientPacket::_internal_has_batch() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || batch_ != nullptr);
+  return value;
+}
+inline bool ClientPacket::has_batch() const {
+  return _internal_has_batch();
+}
+inline void ClientPacket::clear_batch() {
+  if (batch_ != nullptr) batch_->Clear();
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const ::tz::ClientPacket_Batch& ClientPacket::_internal_batch() const {
+  const ::tz::ClientPacket_Batch* p = batch_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tz::ClientPacket_Batch&>(
+      ::tz::_ClientPacket_Batch_default_instance_);
+}
+inline const ::tz::ClientPacket_Batch& ClientPacket::batch() const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.batch)
+  return _internal_batch();
+}
+inline void ClientPacket::unsafe_arena_set_allocated_batch(
+    ::tz::ClientPacket_Batch* batch) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(batch_);
+  }
+  batch_ = batch;
+  if (batch) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tz.ClientPacket.batch)
+}
+inline ::tz::ClientPacket_Batch* ClientPacket::release_batch() {
+  _has_bits_[0] &= ~0x00000002u;
+  ::tz::ClientPacket_Batch* temp = batch_;
+  batch_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tz::ClientPacket_Batch* ClientPacket::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_release:tz.ClientPacket.batch)
+  _has_bits_[0] &= ~0x00000002u;
+  ::tz::ClientPacket_Batch* temp = batch_;
+  batch_ = nullptr;
+  return temp;
+}
+inline ::tz::ClientPacket_Batch* ClientPacket::_internal_mutable_batch() {
+  _has_bits_[0] |= 0x00000002u;
+  if (batch_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tz::ClientPacket_Batch>(GetArenaForAllocation());
+    batch_ = p;
+  }
+  return batch_;
+}
+inline ::tz::ClientPacket_Batch* ClientPacket::mutable_batch() {
+  ::tz::ClientPacket_Batch* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:tz.ClientPacket.batch)
+  return _msg;
+}
+inline void ClientPacket::set_allocated_batch(::tz::ClientPacket_Batch* batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete batch_;
+  }
+  if (batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::tz::ClientPacket_Batch>::GetOwningArena(batch);
+    if (message_arena != submessage_arena) {
+      batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  batch_ = batch;
+  // @@protoc_insertion_point(field_set_allocated:tz.ClientPacket.batch)
+}
+
+// optional .tz.ClientPacket.Columns columns = 4;
+inline bool ClientPacket::_internal_has_columns() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || columns_ != nullptr);
+  return value;
+}
+inline bool ClientPacket::has_columns() const {
+  return _internal_has_columns();
+}
+inline void ClientPacket::clear_columns() {
+  if (columns_ != nullptr) columns_->Clear();
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline const ::tz::ClientPacket_Columns& ClientPacket::_internal_columns() const {
+  const ::tz::ClientPacket_Columns* p = columns_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tz::ClientPacket_Columns&>(
+      ::tz::_ClientPacket_Columns_default_instance_);
+}
+inline const ::tz::ClientPacket_Columns& ClientPacket::columns() const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.columns)
+  return _internal_columns();
+}
+inline void ClientPacket::unsafe_arena_set_allocated_columns(
+    ::tz::ClientPacket_Columns* columns) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(columns_);
+  }
+  columns_ = columns;
+  if (columns) {
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tz.ClientPacket.columns)
+}
+inline ::tz::ClientPacket_Columns* ClientPacket::release_columns() {
+  _has_bits_[0] &= ~0x00000004u;
+  ::tz::ClientPacket_Columns* temp = columns_;
+  columns_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tz::ClientPacket_Columns* ClientPacket::unsafe_arena_release_columns() {
+  // @@protoc_insertion_point(field_release:tz.ClientPacket.columns)
+  _has_bits_[0] &= ~0x00000004u;
+  ::tz::ClientPacket_Columns* temp = columns_;
+  columns_ = nullptr;
+  return temp;
+}
+inline ::tz::ClientPacket_Columns* ClientPacket::_internal_mutable_columns() {
+  _has_bits_[0] |= 0x00000004u;
+  if (columns_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tz::ClientPacket_Columns>(GetArenaForAllocation());
+    columns_ = p;
+  }
+  return columns_;
+}
+inline ::tz::ClientPacket_Columns* ClientPacket::mutable_columns() {
+  ::tz::ClientPacket_Columns* _msg = _internal_mutable_columns();
+  // @@protoc_insertion_point(field_mutable:tz.ClientPacket.columns)
+  return _msg;
+}
+inline void ClientPacket::set_allocated_columns(::tz::ClientPacket_Columns* columns) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete columns_;
+  }
+  if (columns) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::tz::ClientPacket_Columns>::GetOwningArena(columns);
+    if (message_arena != submessage_arena) {
+      columns = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, columns, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000004u;
+  } else {
+    _has_bits_[0] &= ~0x00000004u;
+  }
+  columns_ = columns;
+  // @@protoc_insertion_point(field_set_allocated:tz.ClientPacket.columns)
+}
+
+// optional .tz.ClientPacket.Hello hello = 5;
+inline bool ClientPacket::_internal_has_hello() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || hello_ != nullptr);
+  return value;
+}
+inline bool ClientPacket::has_hello() const {
+  return _internal_has_hello();
+}
+inline void ClientPacket::clear_hello() {
+  if (hello_ != nullptr) hello_->Clear();
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline const ::tz::ClientPacket_Hello& ClientPacket::_internal_hello() const {
+  const ::tz::ClientPacket_Hello* p = hello_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tz::ClientPacket_Hello&>(
+      ::tz::_ClientPacket_Hello_default_instance_);
+}
+inline const ::tz::ClientPacket_Hello& ClientPacket::hello() const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.hello)
+  return _internal_hello();
+}
+inline void ClientPacket::unsafe_arena_set_allocated_hello(
+    ::tz::ClientPacket_Hello* hello) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(hello_);
+  }
+  hello_ = hello;
+  if (hello) {
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tz.ClientPacket.hello)
+}
+inline ::tz::ClientPacket_Hello* ClientPacket::release_hello() {
+  _has_bits_[0] &= ~0x00000008u;
+  ::tz::ClientPacket_Hello* temp = hello_;
+  hello_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tz::ClientPacket_Hello* ClientPacket::unsafe_arena_release_hello() {
+  // @@protoc_insertion_point(field_release:tz.ClientPacket.hello)
+  _has_bits_[0] &= ~0x00000008u;
+  ::tz::ClientPacket_Hello* temp = hello_;
+  hello_ = nullptr;
+  return temp;
+}
+inline ::tz::ClientPacket_Hello* ClientPacket::_internal_mutable_hello() {
+  _has_bits_[0] |= 0x00000008u;
+  if (hello_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tz::ClientPacket_Hello>(GetArenaForAllocation());
+    hello_ = p;
+  }
+  return hello_;
+}
+inline ::tz::ClientPacket_Hello* ClientPacket::mutable_hello() {
+  ::tz::ClientPacket_Hello* _msg = _internal_mutable_hello();
+  // @@protoc_insertion_point(field_mutable:tz.ClientPacket.hello)
+  return _msg;
+}
+inline void ClientPacket::set_allocated_hello(::tz::ClientPacket_Hello* hello) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete hello_;
+  }
+  if (hello) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::tz::ClientPacket_Hello>::GetOwningArena(hello);
+    if (message_arena != submessage_arena) {
+      hello = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hello, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000008u;
+  } else {
+    _has_bits_[0] &= ~0x00000008u;
+  }
+  hello_ = hello;
+  // @@protoc_insertion_point(field_set_allocated:tz.ClientPacket.hello)
+}
+
+// optional .tz.ClientPacket.StatisticsRequest statistics = 6;
+inline bool ClientPacket::_internal_has_statistics() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || statistics_ != nullptr);
+  return value;
+}
+inline bool ClientPacket::has_statistics() const {
+  return _internal_has_statistics();
+}
+inline void ClientPacket::clear_statistics() {
+  if (statistics_ != nullptr) statistics_->Clear();
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline const ::tz::ClientPacket_StatisticsRequest& ClientPacket::_internal_statistics() const {
+  const ::tz::ClientPacket_StatisticsRequest* p = statistics_;
+  return p != nullptr ? *p : reinterpret_cast<const ::tz::ClientPacket_StatisticsRequest&>(
+      ::tz::_ClientPacket_StatisticsRequest_default_instance_);
+}
+inline const ::tz::ClientPacket_StatisticsRequest& ClientPacket::statistics() const {
+  // @@protoc_insertion_point(field_get:tz.ClientPacket.statistics)
+  return _internal_statistics();
+}
+inline void ClientPacket::unsafe_arena_set_allocated_statistics(
+    ::tz::ClientPacket_StatisticsRequest* statistics) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(statistics_);
+  }
+  statistics_ = statistics;
+  if (statistics) {
+    _has_bits_[0] |= 0x00000010u;
+  } else {
+    _has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:tz.ClientPacket.statistics)
+}
+inline ::tz::ClientPacket_StatisticsRequest* ClientPacket::release_statistics() {
+  _has_bits_[0] &= ~0x00000010u;
+  ::tz::ClientPacket_StatisticsRequest* temp = statistics_;
+  statistics_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::tz::ClientPacket_StatisticsRequest* ClientPacket::unsafe_arena_release_statistics() {
+  // @@protoc_insertion_point(field_release:tz.ClientPacket.statistics)
+  _has_bits_[0] &= ~0x00000010u;
+  ::tz::ClientPacket_StatisticsRequest* temp = statistics_;
+  statistics_ = nullptr;
+  return temp;
+}
+inline ::tz::ClientPacket_StatisticsRequest* ClientPacket::_internal_mutable_statistics() {
+  _has_bits_[0] |= 0x00000010u;
+  if (statistics_ == nullptr) {
+    auto* p = CreateMaybeMessage<::tz::ClientPacket_StatisticsRequest>(GetArenaForAllocation());
+    statistics_ = p;
+  }
+  return statistics_;
+}
+inline ::tz::ClientPacket_StatisticsRequest* ClientPacket::mutable_statistics() {
+  ::tz::ClientPacket_StatisticsRequest* _msg = _internal_mutable_statistics();
+  // @@protoc_insertion_point(field_mutable:tz.ClientPacket.statistics)
+  return _msg;
+}
+inline void ClientPacket::set_allocated_statistics(::tz::ClientPacket_StatisticsRequest* statistics) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete statistics_;
+  }
+  if (statistics) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper<::tz::ClientPacket_StatisticsRequest>::GetOwningArena(statistics);
+    if (message_arena != submessage_arena) {
+      statistics = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, statistics, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000010u;
+  } else {
+    _has_bits_[0] &= ~0x00000010u;
+  }
+  statistics_ = statistics;
+  // @@protoc_insertion_point(field_set_allocated:tz.ClientPacket.statistics)
+}
+
+// -------------------------------------------------------------------
+
+// ServerStatistic_WindowStat
+
+// uint32 seconds = 1;
+inline void ServerStatistic_WindowStat::clear_seconds() {
+  seconds_ = 0u;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 ServerStatistic_WindowStat::_internal_seconds() const {
+  return seconds_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint32 ServerStatistic_WindowStat::seconds() const {
+  // @@protoc_insertion_point(field_get:tz.ServerStatistic.WindowStat.seconds)
+  return _internal_seconds();
+}
+inline void ServerStatistic_WindowStat::_internal_set_seconds(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  seconds_ = value;
+}
+inline void ServerStatistic_WindowStat::set_seconds(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_seconds(value);
+  // @@protoc_insertion_point(field_set:tz.ServerStatistic.WindowStat.seconds)
+}
+
+// double x = 2;
+inline void ServerStatistic_WindowStat::clear_x() {
+  x_ = 0;
+}
+inline double ServerStatistic_WindowStat::_internal_x() const {
+  return x_;
+}
+inline double ServerStatistic_WindowStat::x() const {
+  // @@protoc_insertion_point(field_get:tz.ServerStatistic.WindowStat.x)
+  return _internal_x();
+}
+inline void ServerStatistic_WindowStat::_internal_set_x(double value) {
+  
+  x_ = value;
+}
+inline void ServerStatistic_WindowStat::set_x(double value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:tz.ServerStatistic.WindowStat.x)
+}
+
+// double y = 3;
+inline void ServerStatistic_WindowStat::clear_y() {
+  y_ = 0;
+}
+inline double ServerStatistic_WindowStat::_internal_y() const {
+  return y_;
+}
+inline double ServerStatistic_WindowStat::y() const {
+  // @@protoc_insertion_point(field_get:tz.ServerStatistic.WindowStat.y)
+  return _internal_y();
+}
+inline void ServerStatistic_WindowStat::_internal_set_y(double value) {
+  
+  y_ = value;
+}
+inline void ServerStatistic_WindowStat::set_y(double value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:tz.ServerStatistic.WindowStat.y)
+}
+
 // -------------------------------------------------------------------
 
 // ServerStatistic_Statistic
 
-// string uuid = 1;
+// bytes uuid = 1;
 inline void ServerStatistic_Statistic::clear_uuid() {
   uuid_.ClearToEmpty();
 }
@@ -1071,7 +2819,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void ServerStatistic_Statistic::set_uuid(ArgT0&& arg0, ArgT... args) {
  
- uuid_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ uuid_.SetBytes(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:tz.ServerStatistic.Statistic.uuid)
 }
 inline std::string* ServerStatistic_Statistic::mutable_uuid() {
@@ -1185,6 +2933,46 @@ inline void ServerStatistic_Statistic::set_y5(double value) {
   // @@protoc_insertion_point(field_set:tz.ServerStatistic.Statistic.y5)
 }
 
+// repeated .tz.ServerStatistic.WindowStat window = 6;
+inline int ServerStatistic_Statistic::_internal_window_size() const {
+  return window_.size();
+}
+inline int ServerStatistic_Statistic::window_size() const {
+  return _internal_window_size();
+}
+inline void ServerStatistic_Statistic::clear_window() {
+  window_.Clear();
+}
+inline ::tz::ServerStatistic_WindowStat* ServerStatistic_Statistic::mutable_window(int index) {
+  // @@protoc_insertion_point(field_mutable:tz.ServerStatistic.Statistic.window)
+  return window_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ServerStatistic_WindowStat >*
+ServerStatistic_Statistic::mutable_window() {
+  // @@protoc_insertion_point(field_mutable_list:tz.ServerStatistic.Statistic.window)
+  return &window_;
+}
+inline const ::tz::ServerStatistic_WindowStat& ServerStatistic_Statistic::_internal_window(int index) const {
+  return window_.Get(index);
+}
+inline const ::tz::ServerStatistic_WindowStat& ServerStatistic_Statistic::window(int index) const {
+  // @@protoc_insertion_point(field_get:tz.ServerStatistic.Statistic.window)
+  return _internal_window(index);
+}
+inline ::tz::ServerStatistic_WindowStat* ServerStatistic_Statistic::_internal_add_window() {
+  return window_.Add();
+}
+inline ::tz::ServerStatistic_WindowStat* ServerStatistic_Statistic::add_window() {
+  ::tz::ServerStatistic_WindowStat* _add = _internal_add_window();
+  // @@protoc_insertion_point(field_add:tz.ServerStatistic.Statistic.window)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::tz::ServerStatistic_WindowStat >&
+ServerStatistic_Statistic::window() const {
+  // @@protoc_insertion_point(field_list:tz.ServerStatistic.Statistic.window)
+  return window_;
+}
+
 // -------------------------------------------------------------------
 
 // ServerStatistic
@@ -1229,6 +3017,26 @@ ServerStatistic::client() const {
   return client_;
 }
 
+// uint64 version = 2;
+inline void ServerStatistic::clear_version() {
+  version_ = uint64_t{0u};
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ServerStatistic::_internal_version() const {
+  return version_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ServerStatistic::version() const {
+  // @@protoc_insertion_point(field_get:tz.ServerStatistic.version)
+  return _internal_version();
+}
+inline void ServerStatistic::_internal_set_version(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  version_ = value;
+}
+inline void ServerStatistic::set_version(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:tz.ServerStatistic.version)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -1238,6 +3046,16 @@ ServerStatistic::client() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 